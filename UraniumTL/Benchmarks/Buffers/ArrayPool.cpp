@@ -0,0 +1,158 @@
+#include <UnTL/Base/Byte.h>
+#include <UnTL/Buffers/ArrayPool.h>
+#include <UnTL/Memory/VirtualMemoryAllocator.h>
+#include <benchmark/benchmark.h>
+
+using namespace UN;
+
+namespace
+{
+    template<class TLock>
+    ArrayPool<Byte, TLock>* g_Pool = nullptr;
+
+    template<class TLock = std::mutex>
+    void RentReturn(benchmark::State& state, USize magazineCapacity)
+    {
+        auto*& pool = g_Pool<TLock>;
+        if (state.thread_index() == 0)
+        {
+            pool = AllocateObject<ArrayPool<Byte, TLock>>(SystemAllocator::Get(), 1024 * 1024, 50, magazineCapacity);
+            pool->AddRef();
+        }
+
+        const USize arrayLength = state.range(0);
+        for (auto _ : state)
+        {
+            auto array = pool->Rent(arrayLength);
+            benchmark::DoNotOptimize(array.Data());
+            pool->Return(array);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            pool->Release();
+            pool = nullptr;
+        }
+    }
+
+    template<class TLock = std::mutex>
+    void RentReturnBurst(benchmark::State& state, USize magazineCapacity)
+    {
+        auto*& pool = g_Pool<TLock>;
+        if (state.thread_index() == 0)
+        {
+            pool = AllocateObject<ArrayPool<Byte, TLock>>(SystemAllocator::Get(), 1024 * 1024, 50, magazineCapacity);
+            pool->AddRef();
+        }
+
+        constexpr USize BurstLength = 8;
+        const USize arrayLength     = state.range(0);
+
+        ArraySlice<Byte> arrays[BurstLength];
+        for (auto _ : state)
+        {
+            for (auto& array : arrays)
+            {
+                array = pool->Rent(arrayLength);
+            }
+
+            benchmark::DoNotOptimize(arrays);
+            for (auto& array : arrays)
+            {
+                pool->Return(array);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * BurstLength);
+
+        if (state.thread_index() == 0)
+        {
+            pool->Release();
+            pool = nullptr;
+        }
+    }
+
+    //! Rent arrays that are too large to be cached and touch each page of them.
+    void RentReturnLarge(benchmark::State& state, IAllocator* pLargeArrayAllocator)
+    {
+        Ptr pool = AllocateObject<ArrayPool<Byte>>(SystemAllocator::Get(), pLargeArrayAllocator, 1024 * 1024, 50, 16);
+
+        const USize arrayLength = state.range(0);
+        for (auto _ : state)
+        {
+            auto array = pool->Rent(arrayLength);
+            for (USize i = 0; i < arrayLength; i += 4096)
+            {
+                array[i] = Byte{};
+            }
+
+            benchmark::DoNotOptimize(array.Data());
+            pool->Return(array);
+        }
+
+        state.SetBytesProcessed(state.iterations() * arrayLength);
+    }
+} // namespace
+
+static void ArrayPool_RentReturnLarge_System(benchmark::State& state)
+{
+    RentReturnLarge(state, SystemAllocator::Get());
+}
+
+static void ArrayPool_RentReturnLarge_VirtualMemory(benchmark::State& state)
+{
+    VirtualMemoryAllocator allocator;
+    RentReturnLarge(state, &allocator);
+}
+
+static void ArrayPool_RentReturnLarge_HugePages(benchmark::State& state)
+{
+    VirtualMemoryAllocator allocator(true);
+    RentReturnLarge(state, &allocator);
+}
+
+static void ArrayPool_RentReturn_NoMagazines(benchmark::State& state)
+{
+    RentReturn(state, 0);
+}
+
+static void ArrayPool_RentReturn(benchmark::State& state)
+{
+    RentReturn(state, 16);
+}
+
+static void ArrayPool_RentReturn_LockFreeNoMagazines(benchmark::State& state)
+{
+    RentReturn<LockFreeTag>(state, 0);
+}
+
+static void ArrayPool_RentReturnBurst_NoMagazines(benchmark::State& state)
+{
+    RentReturnBurst(state, 0);
+}
+
+static void ArrayPool_RentReturnBurst(benchmark::State& state)
+{
+    RentReturnBurst(state, 16);
+}
+
+static void ArrayPool_RentReturnBurst_LockFreeNoMagazines(benchmark::State& state)
+{
+    RentReturnBurst<LockFreeTag>(state, 0);
+}
+
+#define UN_ARRAY_POOL_BENCHMARK(name)                                                                                            \
+    BENCHMARK(name)->Arg(4 * 1024)->Arg(64 * 1024)->Threads(1)->Threads(4)->Threads(16)->Threads(64)->UseRealTime()
+
+UN_ARRAY_POOL_BENCHMARK(ArrayPool_RentReturn_NoMagazines);
+UN_ARRAY_POOL_BENCHMARK(ArrayPool_RentReturn);
+UN_ARRAY_POOL_BENCHMARK(ArrayPool_RentReturn_LockFreeNoMagazines);
+UN_ARRAY_POOL_BENCHMARK(ArrayPool_RentReturnBurst_NoMagazines);
+UN_ARRAY_POOL_BENCHMARK(ArrayPool_RentReturnBurst);
+UN_ARRAY_POOL_BENCHMARK(ArrayPool_RentReturnBurst_LockFreeNoMagazines);
+
+BENCHMARK(ArrayPool_RentReturnLarge_System)->Arg(4 * 1024 * 1024)->Arg(32 * 1024 * 1024);
+BENCHMARK(ArrayPool_RentReturnLarge_VirtualMemory)->Arg(4 * 1024 * 1024)->Arg(32 * 1024 * 1024);
+BENCHMARK(ArrayPool_RentReturnLarge_HugePages)->Arg(4 * 1024 * 1024)->Arg(32 * 1024 * 1024);
@@ -0,0 +1,66 @@
+#include <UnTL/Containers/ArraySlice.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace UN;
+
+namespace
+{
+    template<class T>
+    std::vector<T> MakeHaystack(USize length)
+    {
+        // The needle is only at the very end, so the whole slice is scanned.
+        std::vector<T> data(length, T(1));
+        data.back() = T(2);
+        return data;
+    }
+
+    template<class T>
+    void FindFirstOfScalar(benchmark::State& state)
+    {
+        const auto data = MakeHaystack<T>(state.range(0));
+        const ArraySlice<const T> slice(data);
+        for (auto _ : state)
+        {
+            const T needle = T(2);
+            benchmark::DoNotOptimize(slice.FindFirstOfPredicate([needle](T x) {
+                return x == needle;
+            }));
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+    }
+
+    template<class T>
+    void FindFirstOfSimd(benchmark::State& state)
+    {
+        const auto data = MakeHaystack<T>(state.range(0));
+        const ArraySlice<const T> slice(data);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.FindFirstOf(T(2)));
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+    }
+
+    template<class T>
+    void FindFirstOfAnySimd(benchmark::State& state)
+    {
+        const auto data = MakeHaystack<T>(state.range(0));
+        const ArraySlice<const T> slice(data);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.FindFirstOfAny(T(2), T(3), T(4)));
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(FindFirstOfScalar, UInt8)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(FindFirstOfSimd, UInt8)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(FindFirstOfAnySimd, UInt8)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(FindFirstOfScalar, Int32)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(FindFirstOfSimd, Int32)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(FindFirstOfAnySimd, Int32)->Arg(64)->Arg(4096);
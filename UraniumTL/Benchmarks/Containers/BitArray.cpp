@@ -0,0 +1,106 @@
+#include <UnTL/Containers/BitArray.h>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace UN;
+
+namespace
+{
+    BitArray MakeRandomBits(USize size, UInt32 seed)
+    {
+        std::mt19937 rng(seed);
+        BitArray result(size);
+        for (USize i = 0; i < size; ++i)
+        {
+            result.Set(i, rng() % 4 == 0);
+        }
+
+        return result;
+    }
+
+    void BoolListCount(benchmark::State& state)
+    {
+        const BitArray bits = MakeRandomBits(state.range(0), 1);
+        List<bool> list;
+        for (USize i = 0; i < bits.Size(); ++i)
+        {
+            list.Push(bits[i]);
+        }
+
+        for (auto _ : state)
+        {
+            USize count = 0;
+            for (bool value : list)
+            {
+                count += value;
+            }
+
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BitArrayCount(benchmark::State& state)
+    {
+        const BitArray bits = MakeRandomBits(state.range(0), 1);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(bits.Count());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void ScalarPopCount(benchmark::State& state)
+    {
+        const BitArray bits = MakeRandomBits(state.range(0), 1);
+        for (auto _ : state)
+        {
+            USize count = 0;
+            for (UInt64 word : bits.Words())
+            {
+                count += Bits::PopCount(word);
+            }
+
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BitArrayAnd(benchmark::State& state)
+    {
+        BitArray a        = MakeRandomBits(state.range(0), 1);
+        const BitArray b = MakeRandomBits(state.range(0), 2);
+        for (auto _ : state)
+        {
+            a &= b;
+            benchmark::DoNotOptimize(a.Words().Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BitArrayForEachSetBit(benchmark::State& state)
+    {
+        const BitArray bits = MakeRandomBits(state.range(0), 1);
+        for (auto _ : state)
+        {
+            USize sum = 0;
+            bits.ForEachSetBit([&sum](USize index) {
+                sum += index;
+            });
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(BoolListCount)->Arg(1 << 22);
+BENCHMARK(BitArrayCount)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(ScalarPopCount)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BitArrayAnd)->Arg(1 << 22);
+BENCHMARK(BitArrayForEachSetBit)->Arg(1 << 22);
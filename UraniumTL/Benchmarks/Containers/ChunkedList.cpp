@@ -0,0 +1,93 @@
+#include <UnTL/Containers/ChunkedList.h>
+#include <UnTL/Strings/String.h>
+#include <benchmark/benchmark.h>
+
+using namespace UN;
+
+namespace
+{
+    template<class TList, class T>
+    void PushElements(benchmark::State& state, const T& value)
+    {
+        const USize count = state.range(0);
+        for (auto _ : state)
+        {
+            TList list;
+            for (USize i = 0; i < count; ++i)
+            {
+                list.Push(value);
+            }
+
+            benchmark::DoNotOptimize(&list.Back());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<class TList>
+    void PushInts(benchmark::State& state)
+    {
+        PushElements<TList>(state, 42);
+    }
+
+    template<class TList>
+    void PushStrings(benchmark::State& state)
+    {
+        // Long enough to be allocated on the heap, so that moving the list is not just a memcpy.
+        PushElements<TList>(state, String(40, 'a'));
+    }
+
+    void SumChunks(benchmark::State& state)
+    {
+        ChunkedList<Int32> list;
+        for (Int32 i = 0; i < state.range(0); ++i)
+        {
+            list.Push(i);
+        }
+
+        for (auto _ : state)
+        {
+            Int64 sum = 0;
+            for (USize i = 0; i < list.ChunkCount(); ++i)
+            {
+                for (Int32 x : list.GetChunk(i))
+                {
+                    sum += x;
+                }
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void SumIterator(benchmark::State& state)
+    {
+        ChunkedList<Int32> list;
+        for (Int32 i = 0; i < state.range(0); ++i)
+        {
+            list.Push(i);
+        }
+
+        for (auto _ : state)
+        {
+            Int64 sum = 0;
+            for (Int32 x : list)
+            {
+                sum += x;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(PushInts, List<Int32>)->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(PushInts, ChunkedList<Int32>)->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(PushStrings, List<String>)->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(PushStrings, ChunkedList<String>)->Arg(1024 * 1024);
+BENCHMARK(SumChunks)->Arg(1024 * 1024);
+BENCHMARK(SumIterator)->Arg(1024 * 1024);
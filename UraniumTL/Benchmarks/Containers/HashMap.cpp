@@ -0,0 +1,134 @@
+#include <UnTL/Containers/HashMap.h>
+#include <UnTL/Memory/Memory.h>
+#include <UnTL/Strings/String.h>
+#include <UnTL/Utils/UUID.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace UN;
+
+namespace
+{
+    template<class TKey>
+    std::vector<TKey> CreateKeys(USize count);
+
+    template<>
+    std::vector<UUID> CreateKeys<UUID>(USize count)
+    {
+        std::vector<UUID> keys;
+        keys.reserve(count);
+        for (USize i = 0; i < count; ++i)
+        {
+            keys.push_back(UUID::Create(i));
+        }
+
+        return keys;
+    }
+
+    template<>
+    std::vector<String> CreateKeys<String>(USize count)
+    {
+        std::vector<String> keys;
+        keys.reserve(count);
+        for (USize i = 0; i < count; ++i)
+        {
+            keys.emplace_back(("Assets/Textures/Texture_" + std::to_string(i) + ".png").c_str());
+        }
+
+        return keys;
+    }
+
+    template<class TKey>
+    void InsertUnorderedMap(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<TKey>(state.range(0));
+        for (auto _ : state)
+        {
+            UnorderedMap<TKey, USize> map;
+            for (USize i = 0; i < keys.size(); ++i)
+            {
+                map[keys[i]] = i;
+            }
+
+            benchmark::DoNotOptimize(map.size());
+        }
+
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+
+    template<class TKey>
+    void InsertHashMap(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<TKey>(state.range(0));
+        for (auto _ : state)
+        {
+            HashMap<TKey, USize> map;
+            for (USize i = 0; i < keys.size(); ++i)
+            {
+                map[keys[i]] = i;
+            }
+
+            benchmark::DoNotOptimize(map.Size());
+        }
+
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+
+    template<class TKey>
+    void FindUnorderedMap(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<TKey>(state.range(0));
+        UnorderedMap<TKey, USize> map;
+        for (USize i = 0; i < keys.size(); ++i)
+        {
+            map[keys[i]] = i;
+        }
+
+        for (auto _ : state)
+        {
+            USize sum = 0;
+            for (const auto& key : keys)
+            {
+                sum += map.find(key)->second;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+
+    template<class TKey>
+    void FindHashMap(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<TKey>(state.range(0));
+        HashMap<TKey, USize> map;
+        for (USize i = 0; i < keys.size(); ++i)
+        {
+            map[keys[i]] = i;
+        }
+
+        for (auto _ : state)
+        {
+            USize sum = 0;
+            for (const auto& key : keys)
+            {
+                sum += *map.TryGet(key);
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(InsertUnorderedMap, UUID)->Arg(1024)->Arg(256 * 1024);
+BENCHMARK_TEMPLATE(InsertHashMap, UUID)->Arg(1024)->Arg(256 * 1024);
+BENCHMARK_TEMPLATE(FindUnorderedMap, UUID)->Arg(1024)->Arg(256 * 1024);
+BENCHMARK_TEMPLATE(FindHashMap, UUID)->Arg(1024)->Arg(256 * 1024);
+
+BENCHMARK_TEMPLATE(InsertUnorderedMap, String)->Arg(1024)->Arg(256 * 1024);
+BENCHMARK_TEMPLATE(InsertHashMap, String)->Arg(1024)->Arg(256 * 1024);
+BENCHMARK_TEMPLATE(FindUnorderedMap, String)->Arg(1024)->Arg(256 * 1024);
+BENCHMARK_TEMPLATE(FindHashMap, String)->Arg(1024)->Arg(256 * 1024);
@@ -0,0 +1,96 @@
+#include <UnTL/Containers/List.h>
+#include <UnTL/Memory/ArenaAllocator.h>
+#include <UnTL/Strings/String.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace UN;
+
+namespace
+{
+    inline constexpr USize ListCount  = 1024 * 1024;
+    inline constexpr Int32 ListLength  = 6;
+
+    void BuildShortLists(std::vector<List<Int32>>& lists, IAllocator* pAllocator)
+    {
+        for (USize i = 0; i < ListCount; ++i)
+        {
+            auto& list = lists.emplace_back(pAllocator);
+            for (Int32 j = 0; j < ListLength; ++j)
+            {
+                list.Push(j);
+            }
+        }
+    }
+
+    void BuildShortListsSystem(benchmark::State& state)
+    {
+        std::vector<List<Int32>> lists;
+        lists.reserve(ListCount);
+        for (auto _ : state)
+        {
+            BuildShortLists(lists, SystemAllocator::Get());
+            benchmark::DoNotOptimize(lists.data());
+            lists.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * ListCount);
+    }
+
+    void BuildShortListsArena(benchmark::State& state)
+    {
+        ArenaAllocator arena;
+        std::vector<List<Int32>> lists;
+        lists.reserve(ListCount);
+        for (auto _ : state)
+        {
+            BuildShortLists(lists, &arena);
+            benchmark::DoNotOptimize(lists.data());
+            lists.clear();
+            arena.Reset();
+        }
+
+        state.SetItemsProcessed(state.iterations() * ListCount);
+    }
+
+    void GrowStringList(benchmark::State& state)
+    {
+        const USize count = state.range(0);
+        const String value(40, 'a');
+        for (auto _ : state)
+        {
+            List<String> list;
+            for (USize i = 0; i < count; ++i)
+            {
+                list.Push(value);
+            }
+
+            benchmark::DoNotOptimize(list.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    void InsertFrontStringList(benchmark::State& state)
+    {
+        const USize count = state.range(0);
+        const String value(40, 'a');
+        for (auto _ : state)
+        {
+            List<String> list;
+            for (USize i = 0; i < count; ++i)
+            {
+                list.Insert(0, value);
+            }
+
+            benchmark::DoNotOptimize(list.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+} // namespace
+
+BENCHMARK(BuildShortListsSystem)->Unit(benchmark::kMillisecond);
+BENCHMARK(BuildShortListsArena)->Unit(benchmark::kMillisecond);
+BENCHMARK(GrowStringList)->Arg(1024)->Arg(64 * 1024);
+BENCHMARK(InsertFrontStringList)->Arg(1024);
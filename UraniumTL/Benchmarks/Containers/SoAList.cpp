@@ -0,0 +1,107 @@
+#include <UnTL/Containers/SoAList.h>
+#include <benchmark/benchmark.h>
+
+using namespace UN;
+
+namespace
+{
+    inline constexpr USize ParticleCount = 1024 * 1024;
+
+    struct Particle
+    {
+        float Position[3];
+        float Velocity[3];
+        float Mass;
+        UInt32 ID;
+    };
+
+    using ParticleList = SoAList<UInt32, float, std::array<float, 3>, std::array<float, 3>>;
+
+    List<Particle> MakeParticleStructs()
+    {
+        List<Particle> particles;
+        particles.Reserve(ParticleCount);
+        for (USize i = 0; i < ParticleCount; ++i)
+        {
+            particles.Push(Particle{ {}, {}, static_cast<float>(i % 7), static_cast<UInt32>(i) });
+        }
+
+        return particles;
+    }
+
+    ParticleList MakeParticleColumns()
+    {
+        ParticleList particles;
+        particles.Reserve(ParticleCount);
+        for (USize i = 0; i < ParticleCount; ++i)
+        {
+            particles.Push(static_cast<UInt32>(i), static_cast<float>(i % 7), std::array<float, 3>{}, std::array<float, 3>{});
+        }
+
+        return particles;
+    }
+
+    void SumMassStructs(benchmark::State& state)
+    {
+        const List<Particle> particles = MakeParticleStructs();
+        for (auto _ : state)
+        {
+            float sum = 0;
+            for (const Particle& particle : particles)
+            {
+                sum += particle.Mass;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * ParticleCount);
+    }
+
+    void SumMassColumns(benchmark::State& state)
+    {
+        const ParticleList particles = MakeParticleColumns();
+        for (auto _ : state)
+        {
+            float sum = 0;
+            for (float mass : particles.Column<1>())
+            {
+                sum += mass;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * ParticleCount);
+    }
+
+    void FindIDStructs(benchmark::State& state)
+    {
+        const List<Particle> particles = MakeParticleStructs();
+        const ArraySlice<const Particle> slice(particles);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.FindFirstOfPredicate([](const Particle& particle) {
+                return particle.ID == ParticleCount - 1;
+            }));
+        }
+
+        state.SetItemsProcessed(state.iterations() * ParticleCount);
+    }
+
+    void FindIDColumns(benchmark::State& state)
+    {
+        const ParticleList particles = MakeParticleColumns();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(particles.Column<0>().FindFirstOf(ParticleCount - 1));
+        }
+
+        state.SetItemsProcessed(state.iterations() * ParticleCount);
+    }
+} // namespace
+
+BENCHMARK(SumMassStructs);
+BENCHMARK(SumMassColumns);
+BENCHMARK(FindIDStructs);
+BENCHMARK(FindIDColumns);
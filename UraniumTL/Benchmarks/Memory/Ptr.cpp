@@ -0,0 +1,67 @@
+#include <UnTL/IO/FileHandle.h>
+#include <UnTL/Memory/Memory.h>
+#include <benchmark/benchmark.h>
+
+using namespace UN;
+
+namespace
+{
+    IO::FileHandle* GetSharedObject()
+    {
+        static Ptr<IO::FileHandle> object = AllocateObject<IO::FileHandle>();
+        return object.Get();
+    }
+
+    //! Copy and destroy a pointer to an object shared by all threads.
+    template<class T>
+    void CopyDestroy(benchmark::State& state)
+    {
+        Ptr<T> source = GetSharedObject();
+        for (auto _ : state)
+        {
+            Ptr<T> copy = source;
+            benchmark::DoNotOptimize(copy.Get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    //! Copy and destroy a pointer to an object that is not shared with other threads.
+    template<class T>
+    void CopyDestroyLocal(benchmark::State& state)
+    {
+        Ptr<T> source = AllocateObject<IO::FileHandle>();
+        for (auto _ : state)
+        {
+            Ptr<T> copy = source;
+            benchmark::DoNotOptimize(copy.Get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+static void Ptr_CopyDestroy_Virtual(benchmark::State& state)
+{
+    CopyDestroy<IObject>(state);
+}
+
+static void Ptr_CopyDestroy_Inline(benchmark::State& state)
+{
+    CopyDestroy<IO::FileHandle>(state);
+}
+
+static void Ptr_CopyDestroyLocal_Virtual(benchmark::State& state)
+{
+    CopyDestroyLocal<IObject>(state);
+}
+
+static void Ptr_CopyDestroyLocal_Inline(benchmark::State& state)
+{
+    CopyDestroyLocal<IO::FileHandle>(state);
+}
+
+BENCHMARK(Ptr_CopyDestroy_Virtual)->Threads(1)->Threads(4);
+BENCHMARK(Ptr_CopyDestroy_Inline)->Threads(1)->Threads(4);
+BENCHMARK(Ptr_CopyDestroyLocal_Virtual)->Threads(1)->Threads(4);
+BENCHMARK(Ptr_CopyDestroyLocal_Inline)->Threads(1)->Threads(4);
@@ -0,0 +1,100 @@
+#include <UnTL/IO/FileHandle.h>
+#include <UnTL/Memory/Memory.h>
+#include <UnTL/Memory/SlabAllocator.h>
+#include <benchmark/benchmark.h>
+
+using namespace UN;
+
+namespace
+{
+    SlabAllocator* g_SlabAllocator = nullptr;
+
+    void AllocateFileHandleSystem(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Ptr handle = AllocateObject<IO::FileHandle>();
+            benchmark::DoNotOptimize(handle.Get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void AllocateFileHandleSlab(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            g_SlabAllocator = new SlabAllocator;
+        }
+
+        for (auto _ : state)
+        {
+            Ptr handle = AllocateObjectEx<IO::FileHandle>(g_SlabAllocator);
+            benchmark::DoNotOptimize(handle.Get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            delete g_SlabAllocator;
+            g_SlabAllocator = nullptr;
+        }
+    }
+
+    void AllocateBurstSystem(benchmark::State& state)
+    {
+        const USize count = state.range(0);
+        std::vector<Ptr<IO::FileHandle>> handles(count);
+        for (auto _ : state)
+        {
+            for (auto& handle : handles)
+            {
+                handle = AllocateObject<IO::FileHandle>();
+            }
+
+            for (auto& handle : handles)
+            {
+                handle.Reset();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    void AllocateBurstSlab(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            g_SlabAllocator = new SlabAllocator;
+        }
+
+        const USize count = state.range(0);
+        std::vector<Ptr<IO::FileHandle>> handles(count);
+        for (auto _ : state)
+        {
+            for (auto& handle : handles)
+            {
+                handle = AllocateObjectEx<IO::FileHandle>(g_SlabAllocator);
+            }
+
+            for (auto& handle : handles)
+            {
+                handle.Reset();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+
+        if (state.thread_index() == 0)
+        {
+            delete g_SlabAllocator;
+            g_SlabAllocator = nullptr;
+        }
+    }
+} // namespace
+
+BENCHMARK(AllocateFileHandleSystem)->Threads(1)->Threads(4)->Threads(16);
+BENCHMARK(AllocateFileHandleSlab)->Threads(1)->Threads(4)->Threads(16);
+BENCHMARK(AllocateBurstSystem)->Arg(1024)->Threads(1)->Threads(4);
+BENCHMARK(AllocateBurstSlab)->Arg(1024)->Threads(1)->Threads(4);
@@ -0,0 +1,92 @@
+#include <UnTL/Parallel/ParallelSort.h>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace UN;
+
+namespace
+{
+    inline constexpr USize RecordCount = 4 * 1024 * 1024;
+
+    struct Record
+    {
+        UInt32 Key;
+        UInt32 Payload[3];
+    };
+
+    List<Record> MakeRecords()
+    {
+        std::mt19937 rng(42);
+        List<Record> records;
+        records.Reserve(RecordCount);
+        for (USize i = 0; i < RecordCount; ++i)
+        {
+            records.Push(Record{ static_cast<UInt32>(rng()), { static_cast<UInt32>(i), 0 } });
+        }
+
+        return records;
+    }
+
+    inline bool CompareRecords(const Record& lhs, const Record& rhs)
+    {
+        return lhs.Key < rhs.Key;
+    }
+
+    void SortRecords(benchmark::State& state)
+    {
+        const List<Record> source = MakeRecords();
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            List<Record> records = source;
+            state.ResumeTiming();
+
+            records.Sort(&CompareRecords);
+            benchmark::DoNotOptimize(records.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * RecordCount);
+    }
+
+    void SortRecordsByMemberRadix(benchmark::State& state)
+    {
+        const List<Record> source = MakeRecords();
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            List<Record> records = source;
+            state.ResumeTiming();
+
+            records.SortByMember(&Record::Key);
+            benchmark::DoNotOptimize(records.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * RecordCount);
+    }
+
+    void ParallelSortRecords(benchmark::State& state)
+    {
+        // The thread that waits for the sort runs tasks too.
+        ThreadPool pool(state.range(0) - 1);
+
+        ParallelSortOptions options;
+        options.pPool = &pool;
+
+        const List<Record> source = MakeRecords();
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            List<Record> records = source;
+            state.ResumeTiming();
+
+            ParallelSort(ArraySlice<Record>(records), &CompareRecords, options);
+            benchmark::DoNotOptimize(records.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * RecordCount);
+    }
+} // namespace
+
+BENCHMARK(SortRecords)->Unit(benchmark::kMillisecond);
+BENCHMARK(SortRecordsByMemberRadix)->Unit(benchmark::kMillisecond);
+BENCHMARK(ParallelSortRecords)->RangeMultiplier(2)->Range(1, 32)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,224 @@
+#include <UnTL/Base/Byte.h>
+#include <UnTL/Parallel/MpmcQueue.h>
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace UN;
+
+namespace
+{
+    inline constexpr USize QueueCapacity = 1024;
+    inline constexpr USize MessageCount  = 1024 * 1024;
+    inline constexpr USize BatchSize     = 32;
+
+    //! The queues pass buffers rented from ArrayPool in the real code, a slice is a good stand-in.
+    using Message = ArraySlice<Byte>;
+
+    template<class TQueue>
+    void PushOne(TQueue& queue, const Message& message)
+    {
+        while (!queue.TryPush(message))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<class TQueue>
+    void PopOne(TQueue& queue, Message& message)
+    {
+        while (!queue.TryPop(message))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    class MutexDequeQueue final
+    {
+        std::mutex m_Mutex;
+        std::deque<Message> m_Messages;
+
+    public:
+        inline bool TryPush(const Message& message)
+        {
+            std::lock_guard lock(m_Mutex);
+            if (m_Messages.size() == QueueCapacity)
+            {
+                return false;
+            }
+
+            m_Messages.push_back(message);
+            return true;
+        }
+
+        inline bool TryPop(Message& message)
+        {
+            std::lock_guard lock(m_Mutex);
+            if (m_Messages.empty())
+            {
+                return false;
+            }
+
+            message = m_Messages.front();
+            m_Messages.pop_front();
+            return true;
+        }
+    };
+
+    template<class TQueue>
+    void OneProducerOneConsumer(benchmark::State& state, TQueue& queue)
+    {
+        for (auto _ : state)
+        {
+            std::thread producer([&queue] {
+                for (USize i = 0; i < MessageCount; ++i)
+                {
+                    PushOne(queue, Message(nullptr, i));
+                }
+            });
+
+            Message message;
+            for (USize i = 0; i < MessageCount; ++i)
+            {
+                PopOne(queue, message);
+            }
+
+            producer.join();
+        }
+
+        state.SetItemsProcessed(state.iterations() * MessageCount);
+    }
+
+    void MutexDequeThroughput(benchmark::State& state)
+    {
+        MutexDequeQueue queue;
+        OneProducerOneConsumer(state, queue);
+    }
+
+    void SpscThroughput(benchmark::State& state)
+    {
+        SpscRingBuffer<Message> queue(QueueCapacity);
+        OneProducerOneConsumer(state, queue);
+    }
+
+    void MpmcThroughput(benchmark::State& state)
+    {
+        MpmcQueue<Message> queue(QueueCapacity);
+        OneProducerOneConsumer(state, queue);
+    }
+
+    template<class TQueue>
+    void BatchThroughput(benchmark::State& state)
+    {
+        TQueue queue(QueueCapacity);
+        for (auto _ : state)
+        {
+            std::thread producer([&queue] {
+                Message messages[BatchSize];
+                for (USize i = 0; i < MessageCount;)
+                {
+                    const USize pushed = queue.TryPushBatch(ArraySlice<const Message>(messages));
+                    if (pushed == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    i += pushed;
+                }
+            });
+
+            Message messages[BatchSize];
+            for (USize i = 0; i < MessageCount;)
+            {
+                const USize popped = queue.TryPopBatch(messages);
+                if (popped == 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                i += popped;
+            }
+
+            producer.join();
+        }
+
+        state.SetItemsProcessed(state.iterations() * MessageCount);
+    }
+
+    MpmcQueue<Message>* g_pContendedQueue = nullptr;
+
+    //! Even threads produce and odd threads consume, all of them share one queue.
+    void MpmcContention(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            g_pContendedQueue = new MpmcQueue<Message>(QueueCapacity);
+        }
+
+        const bool producer = state.thread_index() % 2 == 0;
+        Message message;
+        for (auto _ : state)
+        {
+            if (producer)
+            {
+                PushOne(*g_pContendedQueue, message);
+            }
+            else
+            {
+                PopOne(*g_pContendedQueue, message);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            delete g_pContendedQueue;
+            g_pContendedQueue = nullptr;
+        }
+    }
+
+    //! Measures the round trip of a message to another thread and back through two queues.
+    template<class TQueue>
+    void RoundTripLatency(benchmark::State& state)
+    {
+        TQueue requests(QueueCapacity);
+        TQueue responses(QueueCapacity);
+
+        std::atomic<bool> stop = false;
+        std::thread echo([&] {
+            Message message;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                if (requests.TryPop(message))
+                {
+                    PushOne(responses, message);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        Message message;
+        for (auto _ : state)
+        {
+            PushOne(requests, message);
+            PopOne(responses, message);
+        }
+
+        stop = true;
+        echo.join();
+    }
+} // namespace
+
+BENCHMARK(MutexDequeThroughput)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(SpscThroughput)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(MpmcThroughput)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BatchThroughput, SpscRingBuffer<Message>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BatchThroughput, MpmcQueue<Message>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(MpmcContention)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(RoundTripLatency, SpscRingBuffer<Message>)->UseRealTime();
+BENCHMARK_TEMPLATE(RoundTripLatency, MpmcQueue<Message>)->UseRealTime();
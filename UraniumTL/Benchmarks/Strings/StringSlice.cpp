@@ -0,0 +1,253 @@
+#include <UnTL/Strings/String.h>
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace UN;
+
+namespace
+{
+    std::string MakeCsv()
+    {
+        std::string result;
+        for (int i = 0; result.size() < 1024 * 1024; ++i)
+        {
+            result += "2024-05-17,";
+            result += std::to_string(i);
+            result += ",user";
+            result += std::to_string(i % 97);
+            result += ",OK,Москва\n";
+        }
+
+        return result;
+    }
+
+    //! The implementation before the byte-level search: decode every codepoint with the iterator.
+    List<StringSlice> SplitDecode(StringSlice str, TCodepoint c)
+    {
+        List<StringSlice> result;
+        auto current = str.begin();
+        while (current != str.end())
+        {
+            auto next = current;
+            while (next != str.end() && *next != c)
+            {
+                ++next;
+            }
+
+            result.Emplace(current, next);
+            current = next;
+            if (current != str.end())
+            {
+                ++current;
+            }
+        }
+
+        return result;
+    }
+
+    void SplitFields(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            auto fields = slice.Split(',');
+            benchmark::DoNotOptimize(fields.Data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    void SplitFieldsDecode(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            auto fields = SplitDecode(slice, ',');
+            benchmark::DoNotOptimize(fields.Data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    void SplitLines(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            auto lines = slice.SplitLines();
+            benchmark::DoNotOptimize(lines.Data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    void FindCodepoint(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv() + "€";
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.FindFirstOf(U'€'));
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    //! The needle is only found at the end, it's preceded by a lot of partial matches of the first bytes.
+    const char ShortNeedle[] = "user96,OK,Kazan";
+    const char LongNeedle[]  = "2024-05-17,999999,user96,OK,Kazan and a few more words to make it long";
+
+    template<class TFunc>
+    void FindSubstringImpl(benchmark::State& state, const char* pNeedle, TFunc&& find)
+    {
+        const std::string csv = MakeCsv() + pNeedle;
+        const StringSlice slice(csv.data(), csv.size());
+        const StringSlice needle(pNeedle);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(find(slice, needle));
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    void FindShortSubstring(benchmark::State& state)
+    {
+        FindSubstringImpl(state, ShortNeedle, [](StringSlice str, StringSlice needle) {
+            return str.Find(needle);
+        });
+    }
+
+    void FindShortSubstringStd(benchmark::State& state)
+    {
+        FindSubstringImpl(state, ShortNeedle, [](StringSlice str, StringSlice needle) {
+            return std::string_view(str.Data(), str.Size()).find(std::string_view(needle.Data(), needle.Size()));
+        });
+    }
+
+    void FindLongSubstring(benchmark::State& state)
+    {
+        FindSubstringImpl(state, LongNeedle, [](StringSlice str, StringSlice needle) {
+            return str.Find(needle);
+        });
+    }
+
+    void FindLongSubstringStd(benchmark::State& state)
+    {
+        FindSubstringImpl(state, LongNeedle, [](StringSlice str, StringSlice needle) {
+            return std::string_view(str.Data(), str.Size()).find(std::string_view(needle.Data(), needle.Size()));
+        });
+    }
+
+    void FindLastShortSubstring(benchmark::State& state)
+    {
+        const std::string csv = ShortNeedle + MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.FindLast(ShortNeedle));
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    //! Every position of the text matches both the first and the last byte of the needle.
+    void FindSubstringWorstCase(benchmark::State& state)
+    {
+        const std::string text(1024 * 1024, 'a');
+        const std::string needle = std::string(static_cast<USize>(state.range(0)), 'a') + "ba";
+        const StringSlice slice(text.data(), text.size());
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.Find(StringSlice(needle.data(), needle.size())));
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void CountSubstring(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slice.Count(",OK,"));
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    //! Get the second field of every line: the materializing split allocates a list per line and scans all fields.
+    void LineFieldsSplit(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            USize total = 0;
+            for (StringSlice line : slice.SplitLines())
+            {
+                total += line.Split(',')[1].Size();
+            }
+
+            benchmark::DoNotOptimize(total);
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    void LineFieldsSplitIter(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            USize total = 0;
+            for (StringSlice line : slice.LinesIter())
+            {
+                auto fields = line.SplitIter(',');
+                total += (*++fields.begin()).Size();
+            }
+
+            benchmark::DoNotOptimize(total);
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+
+    void SplitFieldsIter(benchmark::State& state)
+    {
+        const std::string csv = MakeCsv();
+        const StringSlice slice(csv.data(), csv.size());
+        for (auto _ : state)
+        {
+            USize count = 0;
+            for (StringSlice field : slice.SplitIter(','))
+            {
+                count += field.Size();
+            }
+
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetBytesProcessed(state.iterations() * csv.size());
+    }
+} // namespace
+
+BENCHMARK(SplitFields);
+BENCHMARK(SplitFieldsDecode);
+BENCHMARK(SplitLines);
+BENCHMARK(SplitFieldsIter);
+BENCHMARK(LineFieldsSplit);
+BENCHMARK(LineFieldsSplitIter);
+BENCHMARK(FindCodepoint);
+BENCHMARK(FindShortSubstring);
+BENCHMARK(FindShortSubstringStd);
+BENCHMARK(FindLongSubstring);
+BENCHMARK(FindLongSubstringStd);
+BENCHMARK(FindLastShortSubstring);
+BENCHMARK(FindSubstringWorstCase)->Arg(16)->Arg(100);
+BENCHMARK(CountSubstring);
@@ -0,0 +1,96 @@
+#include <UnTL/Strings/Transcode.h>
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace UN;
+
+namespace
+{
+    std::string MakeText(bool ascii)
+    {
+        const std::string sample = ascii ? "The quick brown fox jumps over the lazy dog. "
+                                         : "The quick brown fox — Съешь же ещё этих мягких булок 😀. ";
+        std::string result;
+        while (result.size() < 1024 * 1024)
+        {
+            result += sample;
+        }
+
+        return result;
+    }
+
+    void ToUtf16(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            std::u16string result(UTF8::GetUtf16Length({ text.data(), text.size() }), u'\0');
+            UTF8::TranscodeToUtf16({ text.data(), text.size() }, { result.data(), result.size() });
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void ToUtf16Decode(benchmark::State& state)
+    {
+        // Decode one codepoint at a time like String::ToWideString did before.
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            std::u16string result;
+            const char* it  = text.data();
+            const char* end = it + text.size();
+            while (it < end)
+            {
+                const UInt32 codepoint = UTF8::Decode(it);
+                if (codepoint >= 0x10000)
+                {
+                    result += static_cast<char16_t>(0xd800 + ((codepoint - 0x10000) >> 10));
+                    result += static_cast<char16_t>(0xdc00 + (codepoint & 0x3ff));
+                }
+                else
+                {
+                    result += static_cast<char16_t>(codepoint);
+                }
+            }
+
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void FromUtf16(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        std::u16string utf16(UTF8::GetUtf16Length({ text.data(), text.size() }), u'\0');
+        UTF8::TranscodeToUtf16({ text.data(), text.size() }, { utf16.data(), utf16.size() });
+        for (auto _ : state)
+        {
+            std::string result(UTF8::GetLengthFromUtf16({ utf16.data(), utf16.size() }), '\0');
+            UTF8::TranscodeFromUtf16({ utf16.data(), utf16.size() }, { result.data(), result.size() });
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void ToUtf32(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            std::u32string result(UTF8::GetUtf32Length({ text.data(), text.size() }), U'\0');
+            UTF8::TranscodeToUtf32({ text.data(), text.size() }, { result.data(), result.size() });
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+} // namespace
+
+BENCHMARK(ToUtf16)->Arg(true)->Arg(false);
+BENCHMARK(ToUtf16Decode)->Arg(true)->Arg(false);
+BENCHMARK(FromUtf16)->Arg(true)->Arg(false);
+BENCHMARK(ToUtf32)->Arg(true)->Arg(false);
@@ -0,0 +1,102 @@
+#include <UnTL/Strings/String.h>
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace UN;
+
+namespace
+{
+    std::string MakeText(bool ascii)
+    {
+        const std::string sample = ascii ? "The quick brown fox jumps over the lazy dog. "
+                                         : "The quick brown fox — Съешь же ещё этих мягких булок 😀. ";
+        std::string result;
+        while (result.size() < 1024 * 1024)
+        {
+            result += sample;
+        }
+
+        return result;
+    }
+
+    void ValidateSimd(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(UTF8::Valid(text.data(), text.size()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void ValidateScalar(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(UTF8::Internal::ValidateScalar(reinterpret_cast<const UInt8*>(text.data()), text.size()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void ValidateDecode(benchmark::State& state)
+    {
+        // Decode one codepoint at a time like UTF8::Valid did before the SIMD validator.
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            UInt32 c;
+            int e          = 0;
+            int errors     = 0;
+            const char* it = text.data();
+            while (*it)
+            {
+                it = static_cast<const char*>(UTF8::Internal::utf8_decode(const_cast<char*>(it), &c, &e));
+                errors |= e;
+            }
+
+            benchmark::DoNotOptimize(errors);
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void LengthSimd(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(UTF8::Length(text.data(), text.size()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+
+    void LengthDecode(benchmark::State& state)
+    {
+        const std::string text = MakeText(state.range(0));
+        for (auto _ : state)
+        {
+            USize length    = 0;
+            const char* it  = text.data();
+            const char* end = it + text.size();
+            while (it < end)
+            {
+                UTF8::Decode(it);
+                ++length;
+            }
+
+            benchmark::DoNotOptimize(length);
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.size());
+    }
+} // namespace
+
+BENCHMARK(ValidateSimd)->Arg(true)->Arg(false);
+BENCHMARK(ValidateScalar)->Arg(true)->Arg(false);
+BENCHMARK(ValidateDecode)->Arg(true)->Arg(false);
+BENCHMARK(LengthSimd)->Arg(true)->Arg(false);
+BENCHMARK(LengthDecode)->Arg(true)->Arg(false);
@@ -1,5 +1,7 @@
 #include <Tests/Common/Common.h>
 #include <UnTL/Buffers/ArrayPool.h>
+#include <UnTL/Memory/VirtualMemoryAllocator.h>
+#include <thread>
 
 using namespace UN;
 
@@ -54,3 +56,163 @@ TEST(ArrayPool, RentMultiple)
     }
     EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
 }
+
+TEST(ArrayPool, RentReturnWithoutMagazines)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        Ptr pool = AllocateObject<ArrayPool<int>>(SystemAllocator::Get(), 1024 * 1024, 50, 0);
+
+        auto arr         = pool->Rent(1000);
+        auto* lastAddress = arr.Data();
+
+        pool->Return(arr);
+        arr = pool->Rent(1000);
+        EXPECT_EQ(arr.Data(), lastAddress);
+        pool->Return(arr);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+template<class TLock>
+void RentReturnMultithreaded()
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        Ptr pool = AllocateObject<ArrayPool<int, TLock>>(SystemAllocator::Get());
+
+        List<std::thread> threads;
+        for (Int32 t = 0; t < 4; ++t)
+        {
+            threads.Emplace([&pool, t] {
+                List<ArraySlice<int>> arrays;
+                for (Int32 iteration = 0; iteration < 100; ++iteration)
+                {
+                    for (Int32 i = 0; i < 64; ++i)
+                    {
+                        auto array = pool->Rent(16 << (i % 8));
+                        array[0]   = t;
+                        arrays.Push(array);
+                    }
+
+                    for (auto& array : arrays)
+                    {
+                        ASSERT_EQ(array[0], t);
+                        pool->Return(array);
+                    }
+
+                    arrays.Clear();
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(ArrayPool, RentReturnMultithreaded)
+{
+    RentReturnMultithreaded<std::mutex>();
+}
+
+TEST(ArrayPool, LockFreeRentReturn)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        Ptr pool = AllocateObject<ArrayPool<int, LockFreeTag>>(SystemAllocator::Get(), 1024 * 1024, 50, 0);
+
+        auto arr = pool->Rent(100000);
+        EXPECT_GE(arr.Length(), 100000);
+
+        auto* lastAddress = arr.Data();
+
+        pool->Return(arr);
+        arr = pool->Rent(100000);
+        EXPECT_EQ(arr.Data(), lastAddress);
+        pool->Return(arr);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(ArrayPool, LockFreeRentReturnMultithreaded)
+{
+    RentReturnMultithreaded<LockFreeTag>();
+}
+
+TEST(ArrayPool, LargeArrayAllocator)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        VirtualMemoryAllocator largeArrayAllocator;
+        Ptr pool = AllocateObject<ArrayPool<UInt8>>(SystemAllocator::Get(), &largeArrayAllocator, 1024 * 1024, 50, 16);
+
+        auto small = pool->Rent(1024);
+        EXPECT_EQ(largeArrayAllocator.GetMappedBytes(), 0);
+
+        auto large = pool->Rent(1024 * 1024);
+        EXPECT_GE(largeArrayAllocator.GetMappedBytes(), 1024 * 1024);
+        memset(large.Data(), 0xFF, large.Length());
+
+        auto huge = pool->Rent(4 * 1024 * 1024);
+        EXPECT_GE(largeArrayAllocator.GetMappedBytes(), 5 * 1024 * 1024);
+
+        pool->Return(small);
+        pool->Return(large);
+        pool->Return(huge);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(ArrayPool, ThreadExitFlushesMagazine)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        Ptr pool = AllocateObject<ArrayPool<int>>(SystemAllocator::Get());
+
+        int* pReturned = nullptr;
+        std::thread thread([&pool, &pReturned] {
+            auto array = pool->Rent(100);
+            pReturned  = array.Data();
+            pool->Return(array);
+        });
+        thread.join();
+
+        // The array was cached by the magazine of the exited thread, now it must be in the shared bucket.
+        auto array = pool->Rent(100);
+        EXPECT_EQ(array.Data(), pReturned);
+        pool->Return(array);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(ArrayPool, MorePoolsThanThreadSlots)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        constexpr USize PoolCount = 2 * Internal::ThreadCacheSlotCount + 3;
+        List<Ptr<ArrayPool<int>>> pools;
+        List<int*> arrays;
+        for (USize i = 0; i < PoolCount; ++i)
+        {
+            pools.Push(AllocateObject<ArrayPool<int>>(SystemAllocator::Get()));
+            auto array = pools.Back()->Rent(64);
+            arrays.Push(array.Data());
+            pools.Back()->Return(array);
+        }
+
+        for (USize iteration = 0; iteration < 3; ++iteration)
+        {
+            for (USize i = 0; i < PoolCount; ++i)
+            {
+                auto array = pools[i]->Rent(64);
+                EXPECT_EQ(array.Data(), arrays[i]);
+                pools[i]->Return(array);
+            }
+        }
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
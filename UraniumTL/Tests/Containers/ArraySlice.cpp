@@ -0,0 +1,125 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Strings/StringSlice.h>
+
+using UN::ArraySlice;
+
+template<class T>
+class ArraySliceSearch : public testing::Test
+{
+};
+
+using SearchTypes = testing::Types<UN::Int8, UN::UInt16, UN::Int32, UN::UInt64, float, double>;
+TYPED_TEST_SUITE(ArraySliceSearch, SearchTypes);
+
+TYPED_TEST(ArraySliceSearch, FindFirstLastOf)
+{
+    static_assert(UN::Internal::IsSimdSearchable<TypeParam>);
+
+    for (UN::USize length = 0; length < 80; ++length)
+    {
+        std::vector<TypeParam> data(length, TypeParam(1));
+        ArraySlice<const TypeParam> slice(data);
+        EXPECT_EQ(slice.FindFirstOf(TypeParam(2)), -1);
+        EXPECT_EQ(slice.FindLastOf(TypeParam(2)), -1);
+        EXPECT_FALSE(slice.Contains(TypeParam(2)));
+
+        for (UN::USize i = 0; i < length; ++i)
+        {
+            data[i] = TypeParam(2);
+            EXPECT_EQ(slice.FindFirstOf(TypeParam(2)), static_cast<UN::SSize>(i));
+            EXPECT_EQ(slice.FindLastOf(TypeParam(2)), static_cast<UN::SSize>(i));
+
+            if (i + 1 < length)
+            {
+                data[length - 1] = TypeParam(2);
+                EXPECT_EQ(slice.FindFirstOf(TypeParam(2)), static_cast<UN::SSize>(i));
+                EXPECT_EQ(slice.FindLastOf(TypeParam(2)), static_cast<UN::SSize>(length - 1));
+                data[length - 1] = TypeParam(1);
+            }
+
+            data[i] = TypeParam(1);
+        }
+    }
+}
+
+TYPED_TEST(ArraySliceSearch, FindFirstLastOfAny)
+{
+    for (UN::USize length = 0; length < 80; ++length)
+    {
+        std::vector<TypeParam> data(length, TypeParam(1));
+        ArraySlice<TypeParam> slice(data);
+        EXPECT_EQ(slice.FindFirstOfAny(TypeParam(2), TypeParam(3)), -1);
+        EXPECT_EQ(slice.FindLastOfAny(TypeParam(2), TypeParam(3)), -1);
+
+        for (UN::USize i = 0; i < length; ++i)
+        {
+            data[i]              = TypeParam(3);
+            data[length - i - 1] = TypeParam(2);
+            EXPECT_EQ(slice.FindFirstOfAny(TypeParam(2), TypeParam(3)), static_cast<UN::SSize>(std::min(i, length - i - 1)));
+            EXPECT_EQ(slice.FindLastOfAny(TypeParam(2), TypeParam(3)), static_cast<UN::SSize>(std::max(i, length - i - 1)));
+            data[i]              = TypeParam(1);
+            data[length - i - 1] = TypeParam(1);
+        }
+    }
+}
+
+TEST(ArraySlice, FindFloatingPoint)
+{
+    std::vector<float> data(40, 1.0f);
+    data[20] = -0.0f;
+    data[30] = std::numeric_limits<float>::quiet_NaN();
+
+    ArraySlice<float> slice(data);
+    EXPECT_EQ(slice.FindFirstOf(0.0f), 20);
+    EXPECT_EQ(slice.FindFirstOf(std::numeric_limits<float>::quiet_NaN()), -1);
+}
+
+TEST(ArraySlice, FindPointers)
+{
+    int values[64];
+    std::vector<const int*> data;
+    for (auto& value : values)
+    {
+        data.push_back(&value);
+    }
+
+    ArraySlice<const int*> slice(data);
+    EXPECT_EQ(slice.FindFirstOf(&values[37]), 37);
+    EXPECT_EQ(slice.FindLastOf(&values[3]), 3);
+    EXPECT_EQ(slice.FindFirstOf(nullptr), -1);
+}
+
+TEST(ArraySlice, FindScalar)
+{
+    // Mixed argument types and non-arithmetic types use the scalar path.
+    std::vector<UN::UInt8> bytes(40, 1);
+    bytes[35] = 44;
+    ArraySlice<UN::UInt8> byteSlice(bytes);
+    EXPECT_EQ(byteSlice.FindFirstOfAny(300, 44), 35);
+
+    std::vector<UN::StringSlice> strings = { "a", "b", "c" };
+    ArraySlice<UN::StringSlice> stringSlice(strings);
+    EXPECT_EQ(stringSlice.FindFirstOf("b"), 1);
+    EXPECT_EQ(stringSlice.FindLastOfAny(UN::StringSlice("a"), UN::StringSlice("c")), 2);
+}
+
+TEST(ArraySlice, FindAnyOfNothing)
+{
+    // An empty pack must not instantiate the SIMD path with a zero-sized needle array.
+    std::vector<UN::Int32> values(40, 1);
+    ArraySlice<UN::Int32> slice(values);
+    EXPECT_EQ(slice.FindFirstOfAny(), -1);
+    EXPECT_EQ(slice.FindLastOfAny(), -1);
+    EXPECT_EQ(ArraySlice<UN::Int32>{}.FindFirstOfAny(), -1);
+}
+
+TEST(List, IndexOfSimd)
+{
+    UN::List<UN::Int16> lst;
+    lst.Resize(100, 0);
+    lst[77] = 5;
+    EXPECT_EQ(lst.IndexOf(5), 77);
+    EXPECT_TRUE(lst.Contains(5));
+    EXPECT_FALSE(lst.Contains(6));
+}
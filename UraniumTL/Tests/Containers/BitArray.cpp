@@ -0,0 +1,194 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/BitArray.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <random>
+#include <vector>
+
+using UN::BitArray;
+using UN::USize;
+
+TEST(BitArray, Create)
+{
+    BitArray empty;
+    EXPECT_TRUE(empty.Empty());
+    EXPECT_EQ(empty.Count(), 0);
+    EXPECT_EQ(empty.FindFirstSet(), -1);
+    EXPECT_TRUE(empty.AllSet());
+
+    BitArray ones(130, true);
+    EXPECT_EQ(ones.Size(), 130);
+    EXPECT_EQ(ones.Words().Length(), 3);
+    EXPECT_EQ(ones.Count(), 130);
+    EXPECT_TRUE(ones.AllSet());
+    EXPECT_EQ(ones.Words()[2], 0b11);
+
+    BitArray zeros(130);
+    EXPECT_EQ(zeros.Count(), 0);
+    EXPECT_FALSE(zeros.AnySet());
+}
+
+TEST(BitArray, SetResetFlip)
+{
+    BitArray bits(200);
+    bits.Set(0);
+    bits.Set(63);
+    bits.Set(64);
+    bits.Set(199);
+    EXPECT_TRUE(bits[0]);
+    EXPECT_TRUE(bits.Test(63));
+    EXPECT_TRUE(bits[64]);
+    EXPECT_FALSE(bits[65]);
+    EXPECT_EQ(bits.Count(), 4);
+
+    bits.Reset(63);
+    bits.Flip(1);
+    bits.Flip(0);
+    bits.Set(100, true);
+    bits.Set(199, false);
+    EXPECT_FALSE(bits[0]);
+    EXPECT_TRUE(bits[1]);
+    EXPECT_FALSE(bits[63]);
+    EXPECT_TRUE(bits[100]);
+    EXPECT_FALSE(bits[199]);
+    EXPECT_EQ(bits.Count(), 3);
+
+    bits.FlipAll();
+    EXPECT_EQ(bits.Count(), 197);
+    EXPECT_EQ(bits.Words()[3], ~static_cast<UN::UInt64>(0) >> 56);
+
+    bits.ResetAll();
+    EXPECT_FALSE(bits.AnySet());
+    bits.SetAll();
+    EXPECT_TRUE(bits.AllSet());
+    EXPECT_EQ(bits.Count(), 200);
+}
+
+TEST(BitArray, PushResize)
+{
+    BitArray bits;
+    for (USize i = 0; i < 100; ++i)
+    {
+        bits.Push(i % 3 == 0);
+    }
+
+    EXPECT_EQ(bits.Size(), 100);
+    EXPECT_EQ(bits.Count(), 34);
+    for (USize i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(bits[i], i % 3 == 0);
+    }
+
+    bits.Resize(150, true);
+    EXPECT_EQ(bits.Count(), 84);
+    EXPECT_TRUE(bits[100]);
+    EXPECT_TRUE(bits[149]);
+    EXPECT_FALSE(bits[98]);
+
+    bits.Resize(10);
+    EXPECT_EQ(bits.Count(), 4);
+    EXPECT_EQ(bits.Words().Length(), 1);
+
+    // The bits removed by shrinking must not come back.
+    bits.Resize(64);
+    EXPECT_EQ(bits.Count(), 4);
+
+    bits.Clear();
+    EXPECT_TRUE(bits.Empty());
+}
+
+TEST(BitArray, Find)
+{
+    BitArray bits(300);
+    EXPECT_EQ(bits.FindFirstSet(), -1);
+    EXPECT_EQ(bits.FindFirstUnset(), 0);
+
+    bits.Set(5);
+    bits.Set(64);
+    bits.Set(250);
+    EXPECT_EQ(bits.FindFirstSet(), 5);
+    EXPECT_EQ(bits.FindNextSet(5), 5);
+    EXPECT_EQ(bits.FindNextSet(6), 64);
+    EXPECT_EQ(bits.FindNextSet(65), 250);
+    EXPECT_EQ(bits.FindNextSet(251), -1);
+    EXPECT_EQ(bits.FindNextSet(1000), -1);
+
+    bits.SetAll();
+    bits.Reset(130);
+    EXPECT_EQ(bits.FindFirstUnset(), 130);
+    EXPECT_EQ(bits.FindNextUnset(131), -1);
+
+    std::vector<USize> indices;
+    BitArray sparse(1000);
+    sparse.Set(3);
+    sparse.Set(128);
+    sparse.Set(999);
+    sparse.ForEachSetBit([&](USize index) {
+        indices.push_back(index);
+    });
+
+    EXPECT_EQ(indices, (std::vector<USize>{ 3, 128, 999 }));
+}
+
+TEST(BitArray, SetOperations)
+{
+    std::mt19937 mt(123);
+    std::vector<bool> expectedA, expectedB;
+    BitArray a(1000), b(1000);
+    for (USize i = 0; i < 1000; ++i)
+    {
+        expectedA.push_back(mt() % 2 == 0);
+        expectedB.push_back(mt() % 3 == 0);
+        a.Set(i, expectedA.back());
+        b.Set(i, expectedB.back());
+    }
+
+    const BitArray andResult    = a & b;
+    const BitArray orResult     = a | b;
+    const BitArray xorResult    = a ^ b;
+    const BitArray andNotResult = BitArray(a).AndNot(b);
+    for (USize i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(andResult[i], expectedA[i] && expectedB[i]);
+        EXPECT_EQ(orResult[i], expectedA[i] || expectedB[i]);
+        EXPECT_EQ(xorResult[i], expectedA[i] != expectedB[i]);
+        EXPECT_EQ(andNotResult[i], expectedA[i] && !expectedB[i]);
+    }
+
+    EXPECT_EQ(orResult.Count(), andResult.Count() + xorResult.Count());
+    EXPECT_EQ(a, BitArray(a));
+    EXPECT_NE(a, b);
+}
+
+TEST(BitArray, CountLarge)
+{
+    // Large enough for the vectorized popcount to flush its byte counters several times.
+    std::mt19937_64 mt(42);
+    BitArray bits(100003);
+    USize expected = 0;
+    for (USize i = 0; i < bits.Size(); ++i)
+    {
+        if (mt() % 5 == 0)
+        {
+            bits.Set(i);
+            ++expected;
+        }
+    }
+
+    EXPECT_EQ(bits.Count(), expected);
+    bits.SetAll();
+    EXPECT_EQ(bits.Count(), 100003);
+}
+
+TEST(BitArray, Allocator)
+{
+    UN::TrackingAllocator allocator;
+    {
+        BitArray bits(1000, true, &allocator);
+        BitArray moved(std::move(bits));
+        EXPECT_EQ(moved.GetAllocator(), &allocator);
+        EXPECT_EQ(moved.Count(), 1000);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 1);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
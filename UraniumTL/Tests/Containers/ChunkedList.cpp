@@ -0,0 +1,152 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/ChunkedList.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <UnTL/Strings/String.h>
+
+using UN::ChunkedList;
+
+TEST(ChunkedList, DefaultChunkLength)
+{
+    static_assert(UN::Internal::GetDefaultChunkLength<UN::UInt8>() == 16 * 1024);
+    static_assert(UN::Internal::GetDefaultChunkLength<UN::Int32>() == 4 * 1024);
+    static_assert(UN::Internal::GetDefaultChunkLength<UN::UInt8[20000]>() == 1);
+}
+
+TEST(ChunkedList, Push)
+{
+    ChunkedList<UN::Int32, 4> lst;
+    EXPECT_TRUE(lst.Empty());
+    EXPECT_EQ(lst.Capacity(), 0);
+
+    for (UN::Int32 i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(lst.Push(i), i);
+    }
+
+    EXPECT_EQ(lst.Size(), 10);
+    EXPECT_EQ(lst.Capacity(), 12);
+    EXPECT_EQ(lst.Front(), 0);
+    EXPECT_EQ(lst.Back(), 9);
+    for (UN::Int32 i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(lst[i], i);
+    }
+}
+
+TEST(ChunkedList, StableAddresses)
+{
+    ChunkedList<UN::String, 8> lst;
+    std::vector<const UN::String*> addresses;
+    for (UN::Int32 i = 0; i < 100; ++i)
+    {
+        addresses.push_back(&lst.Push(UN::String(30, 'a')));
+    }
+
+    for (UN::USize i = 0; i < addresses.size(); ++i)
+    {
+        EXPECT_EQ(addresses[i], &lst[i]);
+    }
+
+    // The argument references an element of the list, it must not be moved while the new chunk is allocated.
+    lst.Push(lst[0]);
+    EXPECT_EQ(lst.Back(), UN::String(30, 'a'));
+}
+
+TEST(ChunkedList, Chunks)
+{
+    ChunkedList<UN::Int32, 4> lst;
+    for (UN::Int32 i = 0; i < 10; ++i)
+    {
+        lst.Push(i);
+    }
+
+    ASSERT_EQ(lst.ChunkCount(), 3);
+    EXPECT_EQ(lst.GetChunk(0).Length(), 4);
+    EXPECT_EQ(lst.GetChunk(1)[0], 4);
+    EXPECT_EQ(lst.GetChunk(2).Length(), 2);
+    EXPECT_EQ(reinterpret_cast<UN::USize>(lst.GetChunk(1).Data()) % 16, 0);
+
+    UN::Int32 sum = 0;
+    for (UN::USize i = 0; i < lst.ChunkCount(); ++i)
+    {
+        for (UN::Int32 x : lst.GetChunk(i))
+        {
+            sum += x;
+        }
+    }
+
+    EXPECT_EQ(sum, 45);
+}
+
+TEST(ChunkedList, Iterate)
+{
+    ChunkedList<UN::Int32, 2> lst = { 5, 3, 1, 4, 2 };
+    std::vector<UN::Int32> values(lst.begin(), lst.end());
+    EXPECT_EQ(values, (std::vector<UN::Int32>{ 5, 3, 1, 4, 2 }));
+
+    std::sort(lst.begin(), lst.end());
+    const auto& constList = lst;
+    EXPECT_TRUE(std::is_sorted(constList.begin(), constList.end()));
+    EXPECT_EQ(constList.end() - constList.begin(), 5);
+}
+
+TEST(ChunkedList, Remove)
+{
+    ChunkedList<UN::String, 2> lst;
+    for (UN::Int32 i = 0; i < 5; ++i)
+    {
+        lst.Push(UN::String(20, static_cast<char>('a' + i)));
+    }
+
+    EXPECT_EQ(lst.Pop(), UN::String(20, 'e'));
+    lst.SwapRemoveAt(0);
+    EXPECT_EQ(lst.Size(), 3);
+    EXPECT_EQ(lst[0], UN::String(20, 'd'));
+    lst.RemoveBack();
+    EXPECT_EQ(lst.Size(), 2);
+}
+
+TEST(ChunkedList, CopyMove)
+{
+    ChunkedList<UN::String, 2> lst;
+    lst.Push("one");
+    lst.Push("two");
+    lst.Push("three");
+
+    ChunkedList<UN::String, 2> copy = lst;
+    ASSERT_EQ(copy.Size(), 3);
+    EXPECT_EQ(copy[2], "three");
+
+    const UN::String* pFirst = &lst[0];
+    ChunkedList<UN::String, 2> moved = std::move(lst);
+    EXPECT_EQ(lst.Size(), 0);
+    EXPECT_EQ(&moved[0], pFirst);
+
+    copy = moved;
+    EXPECT_EQ(copy.Size(), 3);
+}
+
+TEST(ChunkedList, Allocator)
+{
+    UN::TrackingAllocator allocator;
+    {
+        ChunkedList<UN::Int32, 16> lst(&allocator);
+        lst.Reserve(40);
+        EXPECT_EQ(lst.Capacity(), 48);
+
+        for (UN::Int32 i = 0; i < 20; ++i)
+        {
+            lst.Push(i);
+        }
+
+        lst.Shrink();
+        EXPECT_EQ(lst.Capacity(), 32);
+
+        lst.Clear();
+        EXPECT_EQ(lst.Capacity(), 32);
+        lst.Shrink();
+        EXPECT_EQ(lst.Capacity(), 0);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
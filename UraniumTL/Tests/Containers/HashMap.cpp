@@ -0,0 +1,210 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/HashMap.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <UnTL/Strings/String.h>
+#include <UnTL/Utils/UUID.h>
+#include <random>
+#include <unordered_map>
+
+using UN::HashMap;
+
+TEST(HashMap, Empty)
+{
+    HashMap<int, int> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Capacity(), 0);
+    EXPECT_FALSE(map.Contains(1));
+    EXPECT_EQ(map.TryGet(1), nullptr);
+    EXPECT_EQ(map.Find(1), map.end());
+    EXPECT_FALSE(map.Remove(1));
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(HashMap, InsertFind)
+{
+    HashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(map.TryEmplace(i, i * 2).second);
+    }
+
+    EXPECT_EQ(map.Size(), 1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto* pValue = map.TryGet(i);
+        ASSERT_NE(pValue, nullptr);
+        EXPECT_EQ(*pValue, i * 2);
+    }
+
+    EXPECT_FALSE(map.Contains(1000));
+    EXPECT_FALSE(map.TryEmplace(10, 0).second);
+    EXPECT_EQ(map[10], 20);
+}
+
+TEST(HashMap, InsertOrAssign)
+{
+    HashMap<int, int> map;
+    EXPECT_TRUE(map.InsertOrAssign(1, 1).second);
+    EXPECT_FALSE(map.InsertOrAssign(1, 2).second);
+    EXPECT_EQ(map[1], 2);
+
+    map[3] = 4;
+    EXPECT_EQ(map.Size(), 2);
+    EXPECT_EQ(*map.TryGet(3), 4);
+}
+
+TEST(HashMap, Remove)
+{
+    HashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+    {
+        map[i] = i;
+    }
+
+    for (int i = 0; i < 100; i += 2)
+    {
+        EXPECT_TRUE(map.Remove(i));
+    }
+
+    EXPECT_EQ(map.Size(), 50);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(map.Contains(i), i % 2 == 1);
+    }
+
+    map.Remove(map.Find(1));
+    EXPECT_FALSE(map.Contains(1));
+    EXPECT_EQ(map.Size(), 49);
+}
+
+TEST(HashMap, Iterate)
+{
+    HashMap<int, int> map = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+    int keySum = 0, valueSum = 0;
+    for (auto& [key, value] : map)
+    {
+        keySum += key;
+        valueSum += value;
+        ++value;
+    }
+
+    EXPECT_EQ(keySum, 9);
+    EXPECT_EQ(valueSum, 12);
+    EXPECT_EQ(map[1], 3);
+}
+
+TEST(HashMap, StringKeys)
+{
+    HashMap<UN::String, int> map;
+    map["a string that is too long to fit into the small string buffer"] = 1;
+    map[UN::String("short")]                                             = 2;
+
+    auto allocationCount = UN::SystemAllocator::Get()->AllocationCount();
+    UN::StringSlice key  = "a string that is too long to fit into the small string buffer";
+    EXPECT_TRUE(map.Contains(key));
+    EXPECT_EQ(*map.TryGet(UN::StringSlice("short")), 2);
+    EXPECT_EQ(*map.TryGet("short"), 2);
+    EXPECT_FALSE(map.Contains(UN::StringSlice("missing")));
+    EXPECT_EQ(UN::SystemAllocator::Get()->AllocationCount(), allocationCount);
+
+    EXPECT_FALSE(map.TryEmplace(key, 3).second);
+    EXPECT_TRUE(map.Remove(key));
+    EXPECT_EQ(map.Size(), 1);
+}
+
+TEST(HashMap, UUIDKeys)
+{
+    HashMap<UN::UUID, int> map;
+    std::vector<UN::UUID> keys;
+    for (int i = 0; i < 100; ++i)
+    {
+        keys.push_back(UN::UUID::Create());
+        map[keys.back()] = i;
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(map[keys[i]], i);
+    }
+}
+
+TEST(HashMap, CopyMove)
+{
+    HashMap<UN::String, UN::String> map;
+    for (int i = 0; i < 50; ++i)
+    {
+        map[UN::String(std::to_string(i).c_str())] = UN::String(static_cast<UN::USize>(i + 30), 'a');
+    }
+
+    HashMap<UN::String, UN::String> copy = map;
+    EXPECT_EQ(copy.Size(), map.Size());
+    for (auto& [key, value] : map)
+    {
+        EXPECT_EQ(*copy.TryGet(key), value);
+    }
+
+    HashMap<UN::String, UN::String> moved = std::move(copy);
+    EXPECT_EQ(moved.Size(), 50);
+    EXPECT_TRUE(copy.Empty());
+}
+
+TEST(HashMap, CustomAllocator)
+{
+    UN::TrackingAllocator allocator;
+    {
+        HashMap<int, int> map(&allocator);
+        EXPECT_EQ(map.GetAllocator(), &allocator);
+        map.Reserve(1000);
+        auto capacity = map.Capacity();
+        EXPECT_GE(capacity, 1000);
+        for (int i = 0; i < 1000; ++i)
+        {
+            map[i] = i;
+        }
+
+        EXPECT_EQ(map.Capacity(), capacity);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 1);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
+
+TEST(HashMap, RandomOperations)
+{
+    std::mt19937 random(123);
+    std::uniform_int_distribution<int> keyDistribution(0, 2000);
+    std::unordered_map<int, int> expected;
+    HashMap<int, int> map;
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        int key = keyDistribution(random);
+        if (random() % 3 == 0)
+        {
+            EXPECT_EQ(map.Remove(key), expected.erase(key) == 1);
+        }
+        else
+        {
+            map[key]      = i;
+            expected[key] = i;
+        }
+    }
+
+    ASSERT_EQ(map.Size(), expected.size());
+    for (auto& [key, value] : expected)
+    {
+        auto* pValue = map.TryGet(key);
+        ASSERT_NE(pValue, nullptr);
+        EXPECT_EQ(*pValue, value);
+    }
+
+    UN::USize count = 0;
+    for (auto& [key, value] : map)
+    {
+        EXPECT_EQ(expected[key], value);
+        ++count;
+    }
+
+    EXPECT_EQ(count, expected.size());
+}
@@ -0,0 +1,54 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/HashSet.h>
+#include <UnTL/Strings/String.h>
+
+using UN::HashSet;
+
+TEST(HashSet, InsertRemove)
+{
+    HashSet<int> set;
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(set.Insert(i));
+    }
+
+    EXPECT_FALSE(set.Insert(5));
+    EXPECT_EQ(set.Size(), 100);
+
+    for (int i = 0; i < 100; i += 3)
+    {
+        EXPECT_TRUE(set.Remove(i));
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(set.Contains(i), i % 3 != 0);
+    }
+}
+
+TEST(HashSet, Iterate)
+{
+    HashSet<int> set = { 1, 2, 3, 2 };
+    EXPECT_EQ(set.Size(), 3);
+
+    int sum = 0;
+    for (int key : set)
+    {
+        sum += key;
+    }
+
+    EXPECT_EQ(sum, 6);
+}
+
+TEST(HashSet, StringKeys)
+{
+    HashSet<UN::String> set;
+    EXPECT_TRUE(set.Insert(UN::StringSlice("abc")));
+    EXPECT_TRUE(set.Insert("def"));
+    EXPECT_FALSE(set.Insert(UN::String("abc")));
+
+    EXPECT_TRUE(set.Contains(UN::StringSlice("abc")));
+    EXPECT_TRUE(set.Contains("def"));
+    EXPECT_EQ(*set.Find(UN::StringSlice("def")), "def");
+    EXPECT_EQ(set.Find(UN::StringSlice("xyz")), set.end());
+}
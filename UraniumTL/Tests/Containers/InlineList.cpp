@@ -0,0 +1,235 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/InlineList.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <UnTL/Strings/String.h>
+
+using UN::InlineList;
+
+TEST(InlineList, StaysInline)
+{
+    InlineList<int, 4> lst;
+    EXPECT_TRUE(lst.IsInline());
+    EXPECT_EQ(lst.Capacity(), 4);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        lst.Push(i);
+    }
+
+    EXPECT_TRUE(lst.IsInline());
+    EXPECT_EQ(lst.Size(), 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(lst[i], i);
+    }
+}
+
+TEST(InlineList, SpillsToHeap)
+{
+    InlineList<int, 4> lst;
+    for (int i = 0; i < 100; ++i)
+    {
+        lst.Push(i);
+    }
+
+    EXPECT_FALSE(lst.IsInline());
+    EXPECT_EQ(lst.Size(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(lst[i], i);
+    }
+}
+
+TEST(InlineList, SpillsObjects)
+{
+    auto mock = std::make_shared<MockConstructors>();
+    EXPECT_CALL(*mock, Construct()).Times(3);
+    EXPECT_CALL(*mock, Destruct()).Times(3);
+    EXPECT_CALL(*mock, Copy()).Times(0);
+    EXPECT_CALL(*mock, Move()).Times(3);
+
+    {
+        InlineList<MockObject, 2> lst;
+        lst.Emplace(mock);
+        lst.Emplace(mock);
+        lst.Emplace(mock);
+        EXPECT_FALSE(lst.IsInline());
+    }
+}
+
+TEST(InlineList, EmplaceSelfReference)
+{
+    InlineList<UN::String, 2> lst;
+    lst.Emplace("a long string that does not fit into the small string buffer");
+    lst.Emplace("b");
+    lst.Push(lst[0]);
+    EXPECT_EQ(lst.Size(), 3);
+    EXPECT_EQ(lst[2], lst[0]);
+}
+
+TEST(InlineList, MoveInline)
+{
+    InlineList<UN::String, 4> a;
+    a.Emplace("a");
+    a.Emplace("b");
+
+    InlineList<UN::String, 4> b(std::move(a));
+    EXPECT_TRUE(a.Empty());
+    EXPECT_TRUE(b.IsInline());
+    EXPECT_EQ(b.Size(), 2);
+    EXPECT_EQ(b[0], "a");
+    EXPECT_EQ(b[1], "b");
+}
+
+TEST(InlineList, MoveHeap)
+{
+    InlineList<int, 2> a = { 1, 2, 3, 4 };
+    const int* pData     = a.Data();
+
+    InlineList<int, 2> b;
+    b = std::move(a);
+    EXPECT_TRUE(a.Empty());
+    EXPECT_TRUE(a.IsInline());
+    EXPECT_EQ(b.Data(), pData);
+    EXPECT_EQ(b.Size(), 4);
+}
+
+TEST(InlineList, Copy)
+{
+    InlineList<int, 2> a = { 1, 2, 3 };
+    InlineList<int, 2> b(a);
+    EXPECT_EQ(b.Size(), 3);
+    EXPECT_NE(a.Data(), b.Data());
+    for (UN::USize i = 0; i < a.Size(); ++i)
+    {
+        EXPECT_EQ(a[i], b[i]);
+    }
+}
+
+TEST(InlineList, Swap)
+{
+    InlineList<int, 2> a = { 1 };
+    InlineList<int, 2> b = { 2, 3, 4 };
+    a.Swap(b);
+    EXPECT_EQ(a.Size(), 3);
+    EXPECT_EQ(b.Size(), 1);
+    EXPECT_EQ(a[2], 4);
+    EXPECT_EQ(b[0], 1);
+}
+
+TEST(InlineList, RemoveAt)
+{
+    InlineList<int, 8> lst = { 1, 2, 3, 4 };
+    lst.RemoveAt(1);
+    EXPECT_EQ(lst.Size(), 3);
+    EXPECT_EQ(lst[0], 1);
+    EXPECT_EQ(lst[1], 3);
+    EXPECT_EQ(lst[2], 4);
+
+    EXPECT_TRUE(lst.Remove(4));
+    EXPECT_FALSE(lst.Remove(4));
+    EXPECT_EQ(lst.Size(), 2);
+}
+
+TEST(InlineList, Sort)
+{
+    InlineList<int, 4> lst = { 5, 3, 1, 4, 2 };
+    lst.Sort();
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(lst[i], i + 1);
+    }
+}
+
+TEST(InlineList, Split)
+{
+    UN::StringSlice str = "a,b,c";
+    auto parts          = str.Split<InlineList<UN::StringSlice, 8>>(',');
+    EXPECT_TRUE(parts.IsInline());
+    ASSERT_EQ(parts.Size(), 3);
+    EXPECT_EQ(parts[0], "a");
+    EXPECT_EQ(parts[1], "b");
+    EXPECT_EQ(parts[2], "c");
+}
+
+TEST(InlineList, CustomAllocator)
+{
+    UN::TrackingAllocator allocator;
+    {
+        InlineList<UN::Int32, 4> lst(&allocator);
+        EXPECT_EQ(lst.GetAllocator(), &allocator);
+        lst.Append(4, 1);
+        EXPECT_EQ(allocator.GetStats().AllocationCount, 0);
+
+        lst.Append(100, 2);
+        EXPECT_FALSE(lst.IsInline());
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 1);
+
+        InlineList<UN::Int32, 4> copy = lst;
+        EXPECT_EQ(copy.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        InlineList<UN::Int32, 4> moved = std::move(copy);
+        EXPECT_EQ(moved.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        InlineList<UN::Int32, 4> system;
+        system = lst;
+        EXPECT_EQ(system.GetAllocator(), UN::SystemAllocator::Get());
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        InlineList<UN::Int32, 4> filled(&allocator, 10, 3);
+        EXPECT_EQ(filled.Size(), 10);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 3);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
+
+TEST(InlineList, Insert)
+{
+    InlineList<UN::Int64, 4> lst = { 1, 3 };
+    lst.Insert(1, 2);
+    lst.Insert(0, 0);
+    EXPECT_TRUE(lst.IsInline());
+
+    lst.Insert(4, 4);
+    EXPECT_FALSE(lst.IsInline());
+    ASSERT_EQ(lst.Size(), 5);
+    for (UN::Int64 i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(lst[i], i);
+    }
+}
+
+TEST(InlineList, InsertSelfReference)
+{
+    const char* longString = "a string that is too long to fit into the small string buffer";
+
+    InlineList<UN::String, 2> lst;
+    lst.Emplace(longString);
+    lst.Emplace("c");
+    lst.Insert(1, lst[0]);
+    lst.Insert(0, "z");
+    ASSERT_EQ(lst.Size(), 4);
+    EXPECT_EQ(lst[0], "z");
+    EXPECT_EQ(lst[1], longString);
+    EXPECT_EQ(lst[2], longString);
+    EXPECT_EQ(lst[3], "c");
+}
+
+TEST(InlineList, InsertNonRelocatable)
+{
+    InlineList<std::string, 4> lst;
+    for (int i = 0; i < 10; ++i)
+    {
+        lst.Emplace(std::to_string(i));
+    }
+
+    lst.Insert(5, "x");
+    lst.Insert(0, lst[10]);
+    ASSERT_EQ(lst.Size(), 12);
+    EXPECT_EQ(lst[0], "9");
+    EXPECT_EQ(lst[6], "x");
+    EXPECT_EQ(lst[11], "9");
+}
@@ -1,5 +1,6 @@
 #include <Tests/Common/Common.h>
 #include <UnTL/Containers/List.h>
+#include <UnTL/Memory/TrackingAllocator.h>
 #include <UnTL/Strings/String.h>
 
 using UN::List;
@@ -279,7 +280,219 @@ TEST(List, Shrink)
     lst.Push(1);
     lst.Shrink();
     ASSERT_LT(lst.Capacity(), cap);
+    ASSERT_EQ(lst.Capacity(), 1);
+    ASSERT_EQ(lst[0], 1);
     lst.RemoveBack();
     lst.Shrink();
     ASSERT_EQ(lst.Capacity(), 0);
 }
+
+TEST(List, GrowTriviallyCopyable)
+{
+    List<UN::Int64> lst;
+    for (UN::Int64 i = 0; i < 100000; ++i)
+    {
+        lst.Push(i);
+    }
+
+    for (UN::Int64 i = 0; i < 100000; ++i)
+    {
+        ASSERT_EQ(lst[i], i);
+    }
+}
+
+TEST(List, CustomAllocator)
+{
+    UN::TrackingAllocator allocator;
+    {
+        List<UN::Int32> lst(&allocator);
+        EXPECT_EQ(lst.GetAllocator(), &allocator);
+        for (UN::Int32 i = 0; i < 100; ++i)
+        {
+            lst.Push(i);
+        }
+
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 1);
+
+        List<UN::Int32> copy = lst;
+        EXPECT_EQ(copy.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        List<UN::Int32> moved = std::move(copy);
+        EXPECT_EQ(moved.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        List<UN::Int32> system;
+        system = lst;
+        EXPECT_EQ(system.GetAllocator(), UN::SystemAllocator::Get());
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
+
+TEST(List, GrowAfterClear)
+{
+    auto allocatedBefore = UN::SystemAllocator::Get()->AllocationCount();
+    {
+        List<UN::Int32> lst;
+        lst.Append(4, 1);
+        lst.Clear();
+        lst.Append(100, 2);
+        EXPECT_EQ(UN::SystemAllocator::Get()->AllocationCount(), allocatedBefore + 1);
+    }
+    EXPECT_EQ(UN::SystemAllocator::Get()->AllocationCount(), allocatedBefore);
+}
+
+static_assert(UN::IsTriviallyRelocatable<UN::Int32>::value);
+static_assert(UN::IsTriviallyRelocatable<UN::String>::value);
+static_assert(UN::IsTriviallyRelocatable<List<UN::String>>::value);
+static_assert(!UN::IsTriviallyRelocatable<std::string>::value);
+
+TEST(List, AppendArray)
+{
+    const UN::Int64 data[] = { 1, 2, 3 };
+
+    List<UN::Int64> lst;
+    lst.Append(3, data);
+    ASSERT_EQ(lst.Size(), 3);
+    EXPECT_EQ(lst[0], 1);
+    EXPECT_EQ(lst[1], 2);
+    EXPECT_EQ(lst[2], 3);
+}
+
+TEST(List, Insert)
+{
+    List<UN::Int64> lst = { 1, 3 };
+    lst.Insert(1, 2);
+    lst.Insert(0, 0);
+    lst.Insert(4, 4);
+    ASSERT_EQ(lst.Size(), 5);
+    for (UN::Int64 i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(lst[i], i);
+    }
+}
+
+TEST(List, InsertRelocatable)
+{
+    const char* longString = "a string that is too long to fit into the small string buffer";
+
+    List<UN::String> lst;
+    lst.Emplace(longString);
+    lst.Emplace("c");
+    lst.Insert(1, lst[0]);
+    lst.Insert(0, "z");
+    ASSERT_EQ(lst.Size(), 4);
+    EXPECT_EQ(lst[0], "z");
+    EXPECT_EQ(lst[1], longString);
+    EXPECT_EQ(lst[2], longString);
+    EXPECT_EQ(lst[3], "c");
+
+    lst.RemoveAt(1);
+    ASSERT_EQ(lst.Size(), 3);
+    EXPECT_EQ(lst[0], "z");
+    EXPECT_EQ(lst[1], longString);
+    EXPECT_EQ(lst[2], "c");
+}
+
+TEST(List, InsertNonRelocatable)
+{
+    // std::string with small string optimization can point to itself, it must be moved element by element.
+    List<std::string> lst;
+    for (int i = 0; i < 10; ++i)
+    {
+        lst.Emplace(std::to_string(i));
+    }
+
+    lst.Insert(5, "x");
+    lst.Insert(0, lst[10]);
+    ASSERT_EQ(lst.Size(), 12);
+    EXPECT_EQ(lst[0], "9");
+    EXPECT_EQ(lst[6], "x");
+    EXPECT_EQ(lst[11], "9");
+
+    lst.RemoveAt(6);
+    lst.RemoveAt(0);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(lst[i], std::to_string(i));
+    }
+}
+
+TEST(List, GrowRelocatable)
+{
+    List<UN::String> lst;
+    for (int i = 0; i < 100; ++i)
+    {
+        lst.Emplace(UN::String(static_cast<UN::USize>(i + 30), 'a'));
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(lst[i].Size(), static_cast<UN::USize>(i + 30));
+    }
+}
+
+TEST(List, SortRadix)
+{
+    UN::TrackingAllocator allocator;
+    List<UN::Int32> lst(&allocator);
+    UN::UInt32 seed = 12345;
+    for (int i = 0; i < 1000; ++i)
+    {
+        seed = seed * 1664525 + 1013904223;
+        lst.Push(static_cast<UN::Int32>(seed));
+    }
+
+    std::vector<UN::Int32> expected(lst.begin(), lst.end());
+    std::sort(expected.begin(), expected.end());
+
+    lst.Sort();
+    EXPECT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 1);
+}
+
+TEST(List, SortByMemberRadix)
+{
+    enum class Priority : UN::UInt8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    struct Item
+    {
+        UN::Int16 Key;
+        Priority Level;
+        UN::UInt32 Index;
+    };
+
+    List<Item> lst;
+    for (UN::UInt32 i = 0; i < 600; ++i)
+    {
+        lst.Push(Item{ static_cast<UN::Int16>((i * 7919) % 301 - 150), static_cast<Priority>(i % 3), i });
+    }
+
+    lst.SortByMember(&Item::Key);
+    for (UN::USize i = 1; i < lst.Size(); ++i)
+    {
+        ASSERT_LE(lst[i - 1].Key, lst[i].Key);
+        if (lst[i - 1].Key == lst[i].Key)
+        {
+            // Radix sort is stable.
+            ASSERT_LT(lst[i - 1].Index, lst[i].Index);
+        }
+    }
+
+    lst.SortByMember(&Item::Level, true);
+    for (UN::USize i = 1; i < lst.Size(); ++i)
+    {
+        ASSERT_GE(lst[i - 1].Level, lst[i].Level);
+        if (lst[i - 1].Level == lst[i].Level)
+        {
+            ASSERT_LE(lst[i - 1].Key, lst[i].Key);
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/SoAList.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <UnTL/Strings/String.h>
+
+using UN::SoAList;
+
+TEST(SoAList, Empty)
+{
+    SoAList<UN::Int32, float> lst;
+    EXPECT_EQ(lst.Size(), 0);
+    EXPECT_EQ(lst.Capacity(), 0);
+    EXPECT_TRUE(lst.Empty());
+    EXPECT_TRUE(lst.Column<0>().Empty());
+}
+
+TEST(SoAList, PushAndGet)
+{
+    SoAList<UN::Int32, double, UN::String> lst;
+    for (UN::Int32 i = 0; i < 100; ++i)
+    {
+        lst.Push(i, i * 0.5, UN::String("value"));
+    }
+
+    ASSERT_EQ(lst.Size(), 100);
+    for (UN::Int32 i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(lst.Get<0>(i), i);
+        EXPECT_EQ(lst.Get<1>(i), i * 0.5);
+        EXPECT_EQ(lst.Get<2>(i), "value");
+
+        auto [id, weight, name] = lst[i];
+        EXPECT_EQ(id, i);
+        EXPECT_EQ(weight, i * 0.5);
+        EXPECT_EQ(name, "value");
+    }
+}
+
+TEST(SoAList, ColumnsAreAligned)
+{
+    SoAList<UN::UInt8, UN::Int64, UN::UInt16> lst;
+    for (UN::Int32 i = 0; i < 37; ++i)
+    {
+        lst.Push(static_cast<UN::UInt8>(i), i, static_cast<UN::UInt16>(i));
+    }
+
+    EXPECT_EQ(reinterpret_cast<UN::USize>(lst.Column<0>().Data()) % 16, 0);
+    EXPECT_EQ(reinterpret_cast<UN::USize>(lst.Column<1>().Data()) % 16, 0);
+    EXPECT_EQ(reinterpret_cast<UN::USize>(lst.Column<2>().Data()) % 16, 0);
+    EXPECT_EQ(lst.Column<1>().FindFirstOf(30), 30);
+    EXPECT_EQ(lst.Column<2>().Length(), 37);
+}
+
+TEST(SoAList, Remove)
+{
+    SoAList<UN::Int32, UN::String> lst;
+    for (UN::Int32 i = 0; i < 5; ++i)
+    {
+        lst.Push(i, UN::String(40, static_cast<char>('a' + i)));
+    }
+
+    lst.RemoveAt(1);
+    ASSERT_EQ(lst.Size(), 4);
+    EXPECT_EQ(lst.Get<0>(1), 2);
+    EXPECT_EQ(lst.Get<1>(1), UN::String(40, 'c'));
+
+    lst.SwapRemoveAt(0);
+    ASSERT_EQ(lst.Size(), 3);
+    EXPECT_EQ(lst.Get<0>(0), 4);
+    EXPECT_EQ(lst.Get<1>(0), UN::String(40, 'e'));
+
+    lst.Pop();
+    ASSERT_EQ(lst.Size(), 2);
+    EXPECT_EQ(lst.Get<0>(1), 2);
+}
+
+TEST(SoAList, Resize)
+{
+    SoAList<UN::Int32, UN::String> lst;
+    lst.Resize(10);
+    EXPECT_EQ(lst.Size(), 10);
+    EXPECT_EQ(lst.Get<0>(9), 0);
+    EXPECT_TRUE(lst.Get<1>(9).Empty());
+
+    lst.Resize(3);
+    EXPECT_EQ(lst.Size(), 3);
+}
+
+TEST(SoAList, CopyMove)
+{
+    SoAList<UN::Int32, UN::String> lst;
+    lst.Push(1, "one");
+    lst.Push(2, "two");
+
+    SoAList<UN::Int32, UN::String> copy = lst;
+    ASSERT_EQ(copy.Size(), 2);
+    EXPECT_EQ(copy.Get<1>(1), "two");
+
+    SoAList<UN::Int32, UN::String> moved = std::move(lst);
+    EXPECT_EQ(lst.Size(), 0);
+    ASSERT_EQ(moved.Size(), 2);
+    EXPECT_EQ(moved.Get<1>(0), "one");
+
+    copy = moved;
+    EXPECT_EQ(copy.Size(), 2);
+}
+
+TEST(SoAList, SortByColumn)
+{
+    SoAList<UN::Int32, UN::String> lst;
+    const UN::Int32 keys[] = { 5, -3, 8, -3, 0 };
+    for (UN::Int32 i = 0; i < 5; ++i)
+    {
+        lst.Push(keys[i], UN::String(30, static_cast<char>('a' + i)));
+    }
+
+    lst.SortByColumn<0>();
+    const UN::Int32 expectedKeys[] = { -3, -3, 0, 5, 8 };
+    const char expectedNames[]     = { 'b', 'd', 'e', 'a', 'c' };
+    for (UN::USize i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(lst.Get<0>(i), expectedKeys[i]);
+        EXPECT_EQ(lst.Get<1>(i), UN::String(30, expectedNames[i]));
+    }
+
+    lst.SortByColumn<1>(true);
+    EXPECT_EQ(lst.Get<0>(0), 0);
+    EXPECT_EQ(lst.Get<0>(4), 5);
+}
+
+TEST(SoAList, SortByColumnRadix)
+{
+    UN::TrackingAllocator allocator;
+    {
+        SoAList<UN::UInt32, UN::UInt32> lst(&allocator);
+        UN::UInt32 seed = 1;
+        for (UN::UInt32 i = 0; i < 1000; ++i)
+        {
+            seed = seed * 1664525 + 1013904223;
+            lst.Push(seed % 100, i);
+        }
+
+        lst.SortByColumn<0>(true);
+        for (UN::USize i = 1; i < lst.Size(); ++i)
+        {
+            ASSERT_GE(lst.Get<0>(i - 1), lst.Get<0>(i));
+            if (lst.Get<0>(i - 1) == lst.Get<0>(i))
+            {
+                ASSERT_LT(lst.Get<1>(i - 1), lst.Get<1>(i));
+            }
+        }
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
@@ -0,0 +1,96 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/HeapArray.h>
+#include <UnTL/Memory/ArenaAllocator.h>
+
+using namespace UN;
+
+TEST(ArenaAllocator, Alignment)
+{
+    ArenaAllocator arena;
+    for (USize alignment = 1; alignment <= 256; alignment *= 2)
+    {
+        arena.Allocate(1, 1);
+        auto* ptr = arena.Allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<USize>(ptr) % alignment, 0);
+    }
+}
+
+TEST(ArenaAllocator, Reset)
+{
+    ArenaAllocator arena(1024);
+    auto* first = arena.Allocate(16, 16);
+    for (Int32 i = 0; i < 1000; ++i)
+    {
+        auto* ptr = static_cast<Int32*>(arena.Allocate(sizeof(Int32) * 4, alignof(Int32)));
+        ptr[3]    = i;
+    }
+
+    arena.Reset();
+    EXPECT_EQ(arena.Allocate(16, 16), first);
+}
+
+TEST(ArenaAllocator, Rewind)
+{
+    ArenaAllocator arena(256);
+    arena.Allocate(100, 1);
+
+    auto marker = arena.GetMarker();
+    auto* ptr   = arena.Allocate(100, 1);
+    for (Int32 i = 0; i < 10; ++i)
+    {
+        arena.Allocate(100, 1);
+    }
+
+    arena.Rewind(marker);
+    EXPECT_EQ(arena.Allocate(100, 1), ptr);
+}
+
+TEST(ArenaAllocator, LargeAllocation)
+{
+    ArenaAllocator arena(1024);
+    auto* small = static_cast<UInt8*>(arena.Allocate(16, 16));
+    auto* large = static_cast<UInt8*>(arena.Allocate(64 * 1024, 16));
+    memset(large, 0xFF, 64 * 1024);
+    small[0] = 0;
+    EXPECT_EQ(large[0], 0xFF);
+}
+
+TEST(ArenaAllocator, FreesMemory)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        ArenaAllocator arena(1024);
+        for (Int32 i = 0; i < 100; ++i)
+        {
+            HeapArray<Int32> array(&arena, 100, i);
+            EXPECT_EQ(array[99], i);
+        }
+
+        arena.Reset();
+        arena.Allocate(4096, 16);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(ArenaAllocator, SizedDeallocate)
+{
+    ArenaAllocator arena;
+    arena.Allocate(10, 1);
+    auto* ptr = arena.Allocate(16, 16);
+    arena.Deallocate(ptr, 16, 16);
+    EXPECT_EQ(arena.Allocate(16, 16), ptr);
+}
+
+TEST(ArenaAllocator, Reallocate)
+{
+    ArenaAllocator arena;
+    auto* ptr = static_cast<UInt8*>(arena.Allocate(16, 16));
+    memset(ptr, 0xAB, 16);
+    EXPECT_EQ(arena.Reallocate(ptr, 16, 256, 16), ptr);
+    EXPECT_EQ(ptr[15], 0xAB);
+
+    arena.Allocate(1, 1);
+    auto* moved = static_cast<UInt8*>(arena.Reallocate(ptr, 256, 512, 16));
+    EXPECT_NE(moved, ptr);
+    EXPECT_EQ(moved[15], 0xAB);
+}
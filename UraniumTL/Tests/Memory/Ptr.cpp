@@ -0,0 +1,185 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Memory/Memory.h>
+#include <thread>
+
+using namespace UN;
+
+namespace
+{
+    class CountedObject final : public Object<IObject>
+    {
+        Int32* m_pDestroyCount;
+
+    public:
+        inline explicit CountedObject(Int32* pDestroyCount)
+            : m_pDestroyCount(pDestroyCount)
+        {
+        }
+
+        inline ~CountedObject() override
+        {
+            ++*m_pDestroyCount;
+        }
+    };
+
+    class CustomReleaseObject final : public Object<IObject>
+    {
+    public:
+        Int32 ReleaseCount = 0;
+
+        inline UInt32 Release() override
+        {
+            ++ReleaseCount;
+            return Object::Release();
+        }
+    };
+
+    class NonFinalObject : public Object<IObject>
+    {
+    };
+} // namespace
+
+static_assert(Internal::HasInlineRefCount<CountedObject>::value);
+static_assert(!Internal::HasInlineRefCount<CustomReleaseObject>::value);
+static_assert(!Internal::HasInlineRefCount<NonFinalObject>::value);
+static_assert(!Internal::HasInlineRefCount<IObject>::value);
+
+TEST(Ptr, InlineRefCount)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    Int32 destroyCount   = 0;
+    {
+        Ptr<CountedObject> first = AllocateObject<CountedObject>(&destroyCount);
+        EXPECT_EQ(first->GetRefCounter()->GetStrongRefCount(), 1);
+        {
+            Ptr<CountedObject> second = first;
+            Ptr<IObject> third        = first;
+            EXPECT_EQ(first->GetRefCounter()->GetStrongRefCount(), 3);
+        }
+
+        EXPECT_EQ(first->GetRefCounter()->GetStrongRefCount(), 1);
+        EXPECT_EQ(destroyCount, 0);
+    }
+    EXPECT_EQ(destroyCount, 1);
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(Ptr, ReleaseThroughInterface)
+{
+    Int32 destroyCount = 0;
+    {
+        Ptr<IObject> object = AllocateObject<CountedObject>(&destroyCount);
+        Ptr<CountedObject> copy(un_assert_cast<CountedObject*>(object.Get()));
+        object.Reset();
+        EXPECT_EQ(destroyCount, 0);
+    }
+    EXPECT_EQ(destroyCount, 1);
+}
+
+TEST(Ptr, CustomRelease)
+{
+    Ptr<CustomReleaseObject> object = AllocateObject<CustomReleaseObject>();
+    {
+        Ptr copy = object;
+    }
+    EXPECT_EQ(object->ReleaseCount, 1);
+}
+
+TEST(Ptr, Multithreaded)
+{
+    Int32 destroyCount = 0;
+    {
+        Ptr<CountedObject> object = AllocateObject<CountedObject>(&destroyCount);
+        std::vector<std::thread> threads;
+        for (Int32 t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([object] {
+                for (Int32 i = 0; i < 10000; ++i)
+                {
+                    Ptr copy = object;
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(object->GetRefCounter()->GetStrongRefCount(), 1);
+    }
+    EXPECT_EQ(destroyCount, 1);
+}
+
+TEST(WeakPtr, TryLock)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    Int32 destroyCount   = 0;
+    {
+        WeakPtr<CountedObject> weak;
+        {
+            Ptr<CountedObject> object = AllocateObject<CountedObject>(&destroyCount);
+            weak                      = object;
+            EXPECT_FALSE(weak.Expired());
+
+            Ptr<CountedObject> locked = weak.TryLock();
+            EXPECT_EQ(locked, object);
+            EXPECT_EQ(object->GetRefCounter()->GetStrongRefCount(), 2);
+        }
+
+        // The object is destroyed, but the memory is still held by the weak pointer.
+        EXPECT_EQ(destroyCount, 1);
+        EXPECT_TRUE(weak.Expired());
+        EXPECT_EQ(weak.TryLock(), nullptr);
+        EXPECT_EQ(allocatedBefore + 1, SystemAllocator::Get()->AllocationCount());
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(WeakPtr, Interface)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        Ptr<NonFinalObject> object = AllocateObject<NonFinalObject>();
+        WeakPtr<IObject> weak      = object;
+        WeakPtr<IObject> copy      = weak;
+        EXPECT_EQ(object->GetRefCounter()->GetWeakRefCount(), 3);
+
+        object.Reset();
+        EXPECT_TRUE(copy.Expired());
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(WeakPtr, Multithreaded)
+{
+    for (Int32 iteration = 0; iteration < 100; ++iteration)
+    {
+        Int32 destroyCount          = 0;
+        Ptr<CountedObject> object   = AllocateObject<CountedObject>(&destroyCount);
+        WeakPtr<CountedObject> weak = object;
+
+        std::vector<std::thread> threads;
+        for (Int32 t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([weak] {
+                for (Int32 i = 0; i < 1000; ++i)
+                {
+                    if (Ptr locked = weak.TryLock())
+                    {
+                        EXPECT_GE(locked->GetRefCounter()->GetStrongRefCount(), 1);
+                    }
+                }
+            });
+        }
+
+        object.Reset();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(destroyCount, 1);
+        EXPECT_TRUE(weak.Expired());
+    }
+}
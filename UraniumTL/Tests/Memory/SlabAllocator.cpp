@@ -0,0 +1,149 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Memory/Memory.h>
+#include <UnTL/Memory/SlabAllocator.h>
+#include <algorithm>
+#include <thread>
+
+using namespace UN;
+
+TEST(SlabAllocator, Alignment)
+{
+    SlabAllocator allocator;
+    for (USize alignment = 1; alignment <= 1024; alignment *= 2)
+    {
+        for (USize size = 1; size <= 1024; size = size * 3 + 1)
+        {
+            auto* ptr = allocator.Allocate(size, alignment);
+            EXPECT_EQ(reinterpret_cast<USize>(ptr) % alignment, 0);
+            memset(ptr, 0xFF, size);
+            allocator.Deallocate(ptr);
+        }
+    }
+}
+
+TEST(SlabAllocator, ReusesMemory)
+{
+    SlabAllocator allocator;
+    auto* first = allocator.Allocate(24, 8);
+    allocator.Deallocate(first);
+    EXPECT_EQ(allocator.Allocate(24, 8), first);
+}
+
+TEST(SlabAllocator, NoOverlap)
+{
+    SlabAllocator allocator;
+    std::vector<Int32*> pointers;
+    for (Int32 i = 0; i < 10000; ++i)
+    {
+        auto* ptr = static_cast<Int32*>(allocator.Allocate(sizeof(Int32) * (i % 100 + 1), alignof(Int32)));
+        ptr[0]    = i;
+        pointers.push_back(ptr);
+    }
+
+    for (Int32 i = 0; i < 10000; ++i)
+    {
+        EXPECT_EQ(pointers[i][0], i);
+        allocator.Deallocate(pointers[i]);
+    }
+}
+
+TEST(SlabAllocator, Objects)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        SlabAllocator allocator;
+        Ptr<Object<IObject>> first = AllocateObjectEx<Object<IObject>>(&allocator);
+        for (Int32 i = 0; i < 1000; ++i)
+        {
+            Ptr<Object<IObject>> object = AllocateObjectEx<Object<IObject>>(&allocator);
+            EXPECT_EQ(object->GetRefCounter()->GetStrongRefCount(), 1);
+        }
+
+        EXPECT_EQ(first->GetRefCounter()->GetStrongRefCount(), 1);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
+
+TEST(SlabAllocator, Multithreaded)
+{
+    SlabAllocator allocator;
+    std::vector<std::thread> threads;
+    for (Int32 t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&allocator, t] {
+            std::vector<Int32*> pointers;
+            for (Int32 i = 0; i < 10000; ++i)
+            {
+                auto* ptr = static_cast<Int32*>(allocator.Allocate(sizeof(Int32) * (i % 8 + 1), alignof(Int32)));
+                ptr[0]    = t;
+                pointers.push_back(ptr);
+            }
+
+            for (auto* ptr : pointers)
+            {
+                EXPECT_EQ(ptr[0], t);
+                allocator.Deallocate(ptr);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST(SlabAllocator, ThreadExitFlushesCache)
+{
+    SlabAllocator allocator;
+    std::vector<void*> threadPointers;
+    std::thread thread([&allocator, &threadPointers] {
+        for (Int32 i = 0; i < 128; ++i)
+        {
+            threadPointers.push_back(allocator.Allocate(64, 8));
+        }
+
+        for (auto* ptr : threadPointers)
+        {
+            allocator.Deallocate(ptr);
+        }
+    });
+    thread.join();
+
+    // The objects cached by the exited thread must be reused instead of carving new ones.
+    std::sort(threadPointers.begin(), threadPointers.end());
+    std::vector<void*> pointers;
+    for (Int32 i = 0; i < 128; ++i)
+    {
+        pointers.push_back(allocator.Allocate(64, 8));
+        EXPECT_TRUE(std::binary_search(threadPointers.begin(), threadPointers.end(), pointers.back()));
+    }
+
+    for (auto* ptr : pointers)
+    {
+        allocator.Deallocate(ptr);
+    }
+}
+
+TEST(SlabAllocator, SizedDeallocate)
+{
+    SlabAllocator allocator;
+    auto* first = allocator.Allocate(40, 8);
+    allocator.Deallocate(first, 40, 8);
+    EXPECT_EQ(allocator.Allocate(40, 8), first);
+
+    auto* large = allocator.Allocate(4096, 16);
+    allocator.Deallocate(large, 4096, 16);
+}
+
+TEST(SlabAllocator, Reallocate)
+{
+    SlabAllocator allocator;
+    auto* ptr = static_cast<UInt8*>(allocator.Allocate(50, 8));
+    memset(ptr, 0xAB, 50);
+    EXPECT_EQ(allocator.Reallocate(ptr, 50, 60, 8), ptr);
+
+    auto* moved = static_cast<UInt8*>(allocator.Reallocate(ptr, 60, 2000, 8));
+    EXPECT_EQ(moved[49], 0xAB);
+    allocator.Deallocate(moved, 2000, 8);
+}
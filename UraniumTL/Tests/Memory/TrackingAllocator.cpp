@@ -0,0 +1,107 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Containers/HeapArray.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <thread>
+
+using namespace UN;
+
+TEST(TrackingAllocator, Stats)
+{
+    TrackingAllocator allocator;
+    auto* small = allocator.Allocate(10, 1);
+    auto* large = allocator.Allocate(1000, 64);
+    EXPECT_EQ(reinterpret_cast<USize>(large) % 64, 0);
+
+    auto stats = allocator.GetStats();
+    EXPECT_EQ(stats.AllocationCount, 2);
+    EXPECT_EQ(stats.LiveAllocationCount(), 2);
+    EXPECT_EQ(stats.BytesInUse, 1010);
+    EXPECT_EQ(stats.TotalBytesAllocated, 1010);
+    EXPECT_EQ(stats.SizeHistogram[3], 1);
+    EXPECT_EQ(stats.SizeHistogram[9], 1);
+
+    allocator.Deallocate(small);
+    allocator.Deallocate(large);
+
+    stats = allocator.GetStats();
+    EXPECT_EQ(stats.DeallocationCount, 2);
+    EXPECT_EQ(stats.LiveAllocationCount(), 0);
+    EXPECT_EQ(stats.BytesInUse, 0);
+    EXPECT_EQ(stats.PeakBytesInUse, 0);
+}
+
+TEST(TrackingAllocator, Alignment)
+{
+    TrackingAllocator allocator;
+    for (USize alignment = 1; alignment <= 256; alignment *= 2)
+    {
+        auto* ptr = allocator.Allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<USize>(ptr) % alignment, 0) << "alignment " << alignment;
+        memset(ptr, 0xAB, 100);
+        allocator.Deallocate(ptr, 100, alignment);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
+
+TEST(TrackingAllocator, PeakBytes)
+{
+    TrackingAllocator allocator;
+    auto* ptr = allocator.Allocate(TrackingAllocator::FlushThreshold * 2, 16);
+    allocator.Deallocate(ptr);
+
+    auto stats = allocator.GetStats();
+    EXPECT_EQ(stats.BytesInUse, 0);
+    EXPECT_EQ(stats.PeakBytesInUse, TrackingAllocator::FlushThreshold * 2);
+}
+
+TEST(TrackingAllocator, Multithreaded)
+{
+    TrackingAllocator allocator;
+    std::vector<std::thread> threads;
+    for (Int32 t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&allocator] {
+            for (Int32 i = 0; i < 1000; ++i)
+            {
+                HeapArray<Int32> array(&allocator, 16);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto stats = allocator.GetStats();
+    EXPECT_EQ(stats.AllocationCount, 8000);
+    EXPECT_EQ(stats.BytesInUse, 0);
+}
+
+TEST(TrackingAllocator, CallSites)
+{
+    auto allocatedBefore = SystemAllocator::Get()->AllocationCount();
+    {
+        TrackingAllocator allocator(SystemAllocator::Get(), true);
+        auto* first  = allocator.Allocate(16, 16);
+        auto* second = allocator.Allocate(32, 16);
+        auto* third  = allocator.Allocate(48, 16);
+        allocator.Deallocate(second);
+
+        std::vector<LiveAllocationInfo> live;
+        allocator.ForEachLiveAllocation([&live](const LiveAllocationInfo& info) {
+            live.push_back(info);
+        });
+
+        ASSERT_EQ(live.size(), 2);
+        EXPECT_EQ(live[0].pPointer, third);
+        EXPECT_EQ(live[0].Size, 48);
+        EXPECT_NE(live[0].pCallSite, nullptr);
+        EXPECT_EQ(live[1].pPointer, first);
+
+        allocator.Deallocate(first);
+        allocator.Deallocate(third);
+    }
+    EXPECT_EQ(allocatedBefore, SystemAllocator::Get()->AllocationCount());
+}
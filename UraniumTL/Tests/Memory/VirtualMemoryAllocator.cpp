@@ -0,0 +1,82 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Memory/VirtualMemoryAllocator.h>
+
+using namespace UN;
+
+TEST(VirtualMemoryAllocator, Alignment)
+{
+    VirtualMemoryAllocator allocator;
+    for (USize alignment = 1; alignment <= 1024 * 1024; alignment *= 4)
+    {
+        auto* ptr = static_cast<UInt8*>(allocator.Allocate(100000, alignment));
+        EXPECT_EQ(reinterpret_cast<USize>(ptr) % alignment, 0);
+        EXPECT_EQ(reinterpret_cast<USize>(ptr) % VirtualMemoryAllocator::GetPageSize(), 0);
+        memset(ptr, 0xFF, 100000);
+        allocator.Deallocate(ptr);
+    }
+}
+
+TEST(VirtualMemoryAllocator, NoHeader)
+{
+    VirtualMemoryAllocator allocator(false, 0);
+    const USize pageSize = VirtualMemoryAllocator::GetPageSize();
+    auto* ptr            = static_cast<UInt8*>(allocator.Allocate(4 * pageSize, 16));
+    memset(ptr, 0xFF, 4 * pageSize);
+    EXPECT_EQ(allocator.GetMappedBytes(), 4 * pageSize);
+    allocator.Deallocate(ptr, 4 * pageSize, 16);
+    EXPECT_EQ(allocator.GetMappedBytes(), 0);
+}
+
+TEST(VirtualMemoryAllocator, SizedDeallocate)
+{
+    VirtualMemoryAllocator allocator;
+    auto* ptr = static_cast<UInt8*>(allocator.Allocate(1024 * 1024, 16));
+    allocator.Deallocate(ptr, 1024 * 1024, 16);
+
+    auto* reused = static_cast<UInt8*>(allocator.Allocate(1024 * 1024, 16));
+    EXPECT_EQ(reused, ptr);
+    allocator.Deallocate(reused, 1024 * 1024, 16);
+}
+
+TEST(VirtualMemoryAllocator, ReusesMappings)
+{
+    VirtualMemoryAllocator allocator;
+    auto* ptr = static_cast<UInt8*>(allocator.Allocate(1024 * 1024, 16));
+    memset(ptr, 0xFF, 1024 * 1024);
+    auto mappedBytes = allocator.GetMappedBytes();
+    allocator.Deallocate(ptr);
+    EXPECT_EQ(allocator.GetMappedBytes(), mappedBytes);
+
+    auto* reused = static_cast<UInt8*>(allocator.Allocate(1024 * 1024, 16));
+    EXPECT_EQ(reused, ptr);
+    EXPECT_EQ(allocator.GetMappedBytes(), mappedBytes);
+    EXPECT_EQ(reused[1000], 0); // decommitted pages are zeroed
+    allocator.Deallocate(reused);
+
+#if !UN_WINDOWS
+    // A larger cached mapping is trimmed to the requested size.
+    auto* trimmed = static_cast<UInt8*>(allocator.Allocate(1000 * 1000, 16));
+    EXPECT_EQ(trimmed, ptr);
+    EXPECT_LT(allocator.GetMappedBytes(), mappedBytes);
+    allocator.Deallocate(trimmed, 1000 * 1000, 16);
+#endif
+}
+
+TEST(VirtualMemoryAllocator, NoCache)
+{
+    VirtualMemoryAllocator allocator(false, 0);
+    auto* ptr = allocator.Allocate(1024 * 1024, 16);
+    EXPECT_GE(allocator.GetMappedBytes(), 1024 * 1024);
+    allocator.Deallocate(ptr);
+    EXPECT_EQ(allocator.GetMappedBytes(), 0);
+}
+
+TEST(VirtualMemoryAllocator, HugePages)
+{
+    VirtualMemoryAllocator allocator(true);
+    auto* ptr = static_cast<UInt8*>(allocator.Allocate(3 * 1024 * 1024, 64));
+    memset(ptr, 0xFF, 3 * 1024 * 1024);
+    EXPECT_EQ(reinterpret_cast<USize>(ptr) % VirtualMemoryAllocator::HugePageSize, 0);
+    EXPECT_EQ(allocator.GetMappedBytes(), 4 * 1024 * 1024);
+    allocator.Deallocate(ptr);
+}
@@ -0,0 +1,132 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Parallel/MpmcQueue.h>
+#include <thread>
+
+using namespace UN;
+
+TEST(MpmcQueue, PushPop)
+{
+    MpmcQueue<Int32> queue(5);
+    EXPECT_EQ(queue.Capacity(), 8);
+
+    for (Int32 i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+
+    EXPECT_FALSE(queue.TryPush(8));
+    EXPECT_EQ(queue.ApproxSize(), 8);
+
+    Int32 value;
+    for (Int32 i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(MpmcQueue, Batch)
+{
+    MpmcQueue<Int32> queue(8);
+
+    const Int32 values[] = { 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.TryPushBatch(values), 6);
+    EXPECT_EQ(queue.TryPushBatch(values), 2);
+    EXPECT_EQ(queue.TryPushBatch(values), 0);
+
+    Int32 result[5];
+    EXPECT_EQ(queue.TryPopBatch(result), 5);
+    EXPECT_EQ(result[4], 4);
+
+    EXPECT_EQ(queue.TryPushBatch(values), 5);
+    EXPECT_EQ(queue.TryPopBatch(result), 5);
+    EXPECT_EQ(result[0], 5);
+    EXPECT_EQ(result[1], 0);
+    EXPECT_EQ(result[2], 1);
+    EXPECT_EQ(queue.TryPopBatch(result), 3);
+    EXPECT_EQ(queue.TryPopBatch(result), 0);
+}
+
+TEST(MpmcQueue, DestroysElements)
+{
+    auto pValue = std::make_shared<Int32>(0);
+    {
+        MpmcQueue<std::shared_ptr<Int32>> queue(4);
+        queue.TryPush(pValue);
+        queue.TryPush(pValue);
+
+        std::shared_ptr<Int32> result;
+        ASSERT_TRUE(queue.TryPop(result));
+        EXPECT_EQ(pValue.use_count(), 3);
+    }
+
+    EXPECT_EQ(pValue.use_count(), 1);
+}
+
+TEST(MpmcQueue, Threads)
+{
+    constexpr USize threadCount   = 4;
+    constexpr USize countPerThread = 20000;
+    MpmcQueue<USize> queue(64);
+
+    std::vector<std::thread> producers;
+    for (USize t = 0; t < threadCount; ++t)
+    {
+        producers.emplace_back([&queue, t] {
+            for (USize i = 0; i < countPerThread;)
+            {
+                const USize values[] = { t * countPerThread + i, t * countPerThread + i + 1 };
+                const USize pushed = queue.TryPushBatch(ArraySlice<const USize>(values, std::min<USize>(2, countPerThread - i)));
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                i += pushed;
+            }
+        });
+    }
+
+    std::vector<std::atomic<Int32>> seen(threadCount * countPerThread);
+    std::atomic<USize> popped = 0;
+
+    std::vector<std::thread> consumers;
+    for (USize t = 0; t < threadCount; ++t)
+    {
+        consumers.emplace_back([&] {
+            USize values[3];
+            while (popped.load() < threadCount * countPerThread)
+            {
+                const USize count = queue.TryPopBatch(values);
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                for (USize i = 0; i < count; ++i)
+                {
+                    seen[values[i]].fetch_add(1);
+                }
+
+                popped.fetch_add(count);
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    for (auto& thread : consumers)
+    {
+        thread.join();
+    }
+
+    for (const auto& count : seen)
+    {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
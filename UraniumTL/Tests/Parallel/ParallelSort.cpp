@@ -0,0 +1,106 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Memory/TrackingAllocator.h>
+#include <UnTL/Parallel/ParallelSort.h>
+#include <UnTL/Strings/String.h>
+#include <random>
+
+using namespace UN;
+
+namespace
+{
+    struct Record
+    {
+        Int64 Key;
+        UInt32 Index;
+
+        [[nodiscard]] inline Int64 GetKey() const
+        {
+            return Key;
+        }
+    };
+} // namespace
+
+TEST(ParallelSort, Integers)
+{
+    ThreadPool pool(3);
+
+    std::mt19937 rng(42);
+    for (USize length : { 0, 1, 100, 1000, 12345 })
+    {
+        List<Int32> values;
+        for (USize i = 0; i < length; ++i)
+        {
+            values.Push(static_cast<Int32>(rng() % 1000) - 500);
+        }
+
+        std::vector<Int32> expected(values.begin(), values.end());
+        std::sort(expected.begin(), expected.end());
+
+        ParallelSortOptions options;
+        options.pPool     = &pool;
+        options.GrainSize = 64;
+        ParallelSort(ArraySlice<Int32>(values), options);
+        EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST(ParallelSort, Predicate)
+{
+    std::mt19937 rng(7);
+    List<Int32> values;
+    for (USize i = 0; i < 5000; ++i)
+    {
+        values.Push(static_cast<Int32>(rng()));
+    }
+
+    ParallelSortOptions options;
+    options.GrainSize = 100;
+    ParallelSort(ArraySlice<Int32>(values), std::greater<>{}, options);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>{}));
+}
+
+TEST(ParallelSort, Strings)
+{
+    ThreadPool pool(2);
+    TrackingAllocator allocator;
+
+    std::mt19937 rng(1);
+    List<String> values;
+    for (USize i = 0; i < 3000; ++i)
+    {
+        values.Push(String(40, static_cast<char>('a' + rng() % 26)));
+    }
+
+    std::vector<String> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+
+    ParallelSortOptions options;
+    options.pPool      = &pool;
+    options.GrainSize  = 50;
+    options.pAllocator = &allocator;
+    ParallelSort(ArraySlice<String>(values), options);
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
+
+TEST(ParallelSort, ByMember)
+{
+    std::mt19937 rng(3);
+    List<Record> records;
+    for (UInt32 i = 0; i < 4000; ++i)
+    {
+        records.Push(Record{ static_cast<Int64>(rng() % 100), i });
+    }
+
+    ParallelSortOptions options;
+    options.GrainSize = 128;
+    ParallelSortByMember(ArraySlice<Record>(records), &Record::Key, false, options);
+    EXPECT_TRUE(std::is_sorted(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) {
+        return lhs.Key < rhs.Key;
+    }));
+
+    ParallelSortByMember(ArraySlice<Record>(records), &Record::GetKey, true, options);
+    EXPECT_TRUE(std::is_sorted(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) {
+        return lhs.Key > rhs.Key;
+    }));
+}
@@ -0,0 +1,111 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Parallel/SpscRingBuffer.h>
+#include <thread>
+
+using namespace UN;
+
+TEST(SpscRingBuffer, PushPop)
+{
+    SpscRingBuffer<Int32> queue(3);
+    EXPECT_EQ(queue.Capacity(), 4);
+
+    for (Int32 i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+
+    EXPECT_FALSE(queue.TryPush(4));
+    EXPECT_EQ(queue.ApproxSize(), 4);
+
+    Int32 value;
+    for (Int32 i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(SpscRingBuffer, Batch)
+{
+    SpscRingBuffer<Int32> queue(8);
+
+    const Int32 values[] = { 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.TryPushBatch(values), 6);
+    EXPECT_EQ(queue.TryPushBatch(values), 2);
+
+    Int32 result[5];
+    EXPECT_EQ(queue.TryPopBatch(result), 5);
+    EXPECT_EQ(result[4], 4);
+
+    // Wrap around the end of the buffer.
+    EXPECT_EQ(queue.TryPushBatch(values), 5);
+    EXPECT_EQ(queue.TryPopBatch(result), 5);
+    EXPECT_EQ(result[0], 5);
+    EXPECT_EQ(result[1], 0);
+    EXPECT_EQ(result[2], 1);
+    EXPECT_EQ(result[3], 0);
+    EXPECT_EQ(result[4], 1);
+}
+
+TEST(SpscRingBuffer, DestroysElements)
+{
+    auto pValue = std::make_shared<Int32>(0);
+    {
+        SpscRingBuffer<std::shared_ptr<Int32>> queue(4);
+        queue.TryPush(pValue);
+        queue.TryPush(pValue);
+
+        std::shared_ptr<Int32> result;
+        ASSERT_TRUE(queue.TryPop(result));
+        EXPECT_EQ(pValue.use_count(), 3);
+    }
+
+    EXPECT_EQ(pValue.use_count(), 1);
+}
+
+TEST(SpscRingBuffer, Threads)
+{
+    constexpr USize count = 100000;
+    SpscRingBuffer<USize> queue(64);
+
+    std::thread producer([&queue] {
+        USize values[7];
+        USize next = 0;
+        while (next < count)
+        {
+            const USize batchSize = std::min<USize>(next % 7 + 1, count - next);
+            for (USize i = 0; i < batchSize; ++i)
+            {
+                values[i] = next + i;
+            }
+
+            const USize pushed = queue.TryPushBatch(ArraySlice<const USize>(values, batchSize));
+            if (pushed == 0)
+            {
+                std::this_thread::yield();
+            }
+
+            next += pushed;
+        }
+    });
+
+    USize expected = 0;
+    USize values[5];
+    while (expected < count)
+    {
+        const USize popped = queue.TryPopBatch(values);
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+        }
+
+        for (USize i = 0; i < popped; ++i)
+        {
+            ASSERT_EQ(values[i], expected++);
+        }
+    }
+
+    producer.join();
+}
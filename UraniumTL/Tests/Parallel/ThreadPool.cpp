@@ -0,0 +1,140 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Parallel/ThreadPool.h>
+#include <numeric>
+
+using namespace UN;
+
+TEST(ThreadPool, RunTasks)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.WorkerCount(), 4);
+    EXPECT_EQ(pool.Concurrency(), 5);
+
+    std::atomic<Int32> counter = 0;
+    auto increment             = [&counter] {
+        counter.fetch_add(1);
+    };
+
+    TaskGroup group(&pool);
+    for (Int32 i = 0; i < 100; ++i)
+    {
+        group.Run(increment);
+    }
+
+    group.Wait();
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPool, NoWorkers)
+{
+    ThreadPool pool(0);
+
+    bool called = false;
+    auto task   = [&called] {
+        called = true;
+    };
+
+    TaskGroup group(&pool);
+    group.Run(task);
+    group.Wait();
+    EXPECT_TRUE(called);
+}
+
+TEST(ThreadPool, NestedGroups)
+{
+    ThreadPool pool(3);
+
+    std::atomic<Int32> leafCount = 0;
+    std::function<void(Int32)> recurse;
+    recurse = [&](Int32 depth) {
+        if (depth == 0)
+        {
+            leafCount.fetch_add(1);
+            return;
+        }
+
+        TaskGroup group(&pool);
+        auto left = [&] {
+            recurse(depth - 1);
+        };
+
+        group.Run(left);
+        recurse(depth - 1);
+        group.Wait();
+    };
+
+    recurse(10);
+    EXPECT_EQ(leafCount.load(), 1024);
+}
+
+TEST(ThreadPool, WaitForRunningTask)
+{
+    // The only task is taken by the worker, so the waiting thread has nothing to run and must sleep
+    // until the worker completes the task.
+    ThreadPool pool(1);
+    for (Int32 iteration = 0; iteration < 20; ++iteration)
+    {
+        std::atomic<bool> started = false;
+        std::atomic<bool> done    = false;
+        auto task                 = [&] {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            done.store(true);
+        };
+
+        TaskGroup group(&pool);
+        group.Run(task);
+        while (!started.load())
+        {
+            std::this_thread::yield();
+        }
+
+        group.Wait();
+        EXPECT_TRUE(done.load());
+    }
+}
+
+TEST(ThreadPool, WaitWakesForNewTasks)
+{
+    // The waiting thread sleeps while the worker runs the outer task, then wakes up to help with the tasks it spawns.
+    ThreadPool pool(1);
+    std::atomic<Int32> counter = 0;
+    auto increment             = [&counter] {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        counter.fetch_add(1);
+    };
+
+    auto outer = [&] {
+        TaskGroup inner(&pool);
+        for (Int32 i = 0; i < 64; ++i)
+        {
+            inner.Run(increment);
+        }
+
+        inner.Wait();
+    };
+
+    TaskGroup group(&pool);
+    group.Run(outer);
+    group.Wait();
+    EXPECT_EQ(counter.load(), 64);
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+    ThreadPool pool(4);
+
+    std::vector<Int32> values(10000);
+    ParallelFor(&pool, 0, values.size(), 64, [&values](USize begin, USize end) {
+        EXPECT_LE(end - begin, 64);
+        for (USize i = begin; i < end; ++i)
+        {
+            values[i] = static_cast<Int32>(i);
+        }
+    });
+
+    for (USize i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(values[i], static_cast<Int32>(i));
+    }
+}
@@ -1,5 +1,7 @@
+#include <UnTL/Memory/TrackingAllocator.h>
 #include <UnTL/Strings/String.h>
 #include <gtest/gtest.h>
+#include <random>
 
 using namespace UN;
 
@@ -138,6 +140,22 @@ TEST(Strings, LongConcat)
     ASSERT_EQ(c(128, 256), b);
 }
 
+TEST(Strings, LongAppend)
+{
+    String str(64, 'A');
+    for (Int32 i = 0; i < 1000; ++i)
+    {
+        str.Append("B");
+    }
+
+    str.Append(str.Data(), 64); // append from own buffer
+    str.Reserve(4096);
+    ASSERT_EQ(str.Size(), 1128);
+    ASSERT_EQ(str(0, 64), String(64, 'A'));
+    ASSERT_EQ(str(64, 1064), String(1000, 'B'));
+    ASSERT_EQ(str(1064, 1128), String(64, 'A'));
+}
+
 TEST(Strings, ShrinkReserve)
 {
     String str;
@@ -212,6 +230,281 @@ TEST(Strings, SplitLines)
     EXPECT_EQ(split[2], StringSlice("123"));
 }
 
+TEST(Strings, SplitMultibyte)
+{
+    // The separator is a 3-byte sequence, the parts contain codepoints with the same continuation bytes.
+    auto str   = String("абв€где€€ж€");
+    auto split = str.Split(U'€');
+    ASSERT_EQ(split.Size(), 4);
+    EXPECT_EQ(split[0], StringSlice("абв"));
+    EXPECT_EQ(split[1], StringSlice("где"));
+    EXPECT_EQ(split[2], StringSlice(""));
+    EXPECT_EQ(split[3], StringSlice("ж"));
+}
+
+TEST(Strings, SplitLong)
+{
+    String str;
+    for (int i = 0; i < 100; ++i)
+    {
+        str += "field";
+        str += String(i % 7, 'x');
+        str += ",";
+    }
+
+    auto split = str.Split(',');
+    ASSERT_EQ(split.Size(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(split[i].Size(), 5 + i % 7);
+    }
+
+    const String text = "first\r\n\nsecond line\r\nthird line is longer than thirty-two bytes\n";
+    auto lines        = text.SplitLines();
+    ASSERT_EQ(lines.Size(), 4);
+    EXPECT_EQ(lines[0], StringSlice("first"));
+    EXPECT_EQ(lines[1], StringSlice(""));
+    EXPECT_EQ(lines[2], StringSlice("second line"));
+    EXPECT_EQ(lines[3], StringSlice("third line is longer than thirty-two bytes"));
+}
+
+TEST(Strings, FindCodepoint)
+{
+    const String str = "loooooooooooooooooooooooooooooooooooong qЯwgЫЧ Я!";
+    const StringSlice slice = str;
+    auto offset             = [&slice](StringSlice::Iterator it) {
+        return StringSlice(slice.begin(), it).Size();
+    };
+
+    EXPECT_EQ(offset(slice.FindFirstOf(U'Я')), 41);
+    EXPECT_EQ(offset(slice.FindLastOf(U'Я')), 50);
+    EXPECT_EQ(offset(slice.FindFirstOf(U'!')), 52);
+    EXPECT_EQ(offset(slice.FindFirstOf(slice.FindFirstOf(U'Я') + 1, U'Я')), 50);
+    EXPECT_EQ(slice.FindFirstOf(U'Ж'), slice.end());
+    EXPECT_EQ(slice.FindLastOf(U'Ж'), slice.end());
+
+    // 'Ы' (D0 AB) and 'Ч' (D0 A7) share the lead byte with 'Я' (D0 AF).
+    EXPECT_EQ(offset(slice.FindFirstOf(U'Ч')), 47);
+    EXPECT_TRUE(slice.Contains(U'w'));
+    EXPECT_FALSE(slice.Contains(U'z'));
+    EXPECT_FALSE(slice.Contains(static_cast<TCodepoint>(0x110000)));
+}
+
+TEST(Strings, FindSubstring)
+{
+    const String str = "The quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat";
+    EXPECT_EQ(str.Find("quick"), 4);
+    EXPECT_EQ(str.Find("quick", 5), 49);
+    EXPECT_EQ(str.FindLast("quick"), 49);
+    EXPECT_EQ(str.Find("T"), 0);
+    EXPECT_EQ(str.FindLast("cat"), 85);
+    EXPECT_EQ(str.Find("lazy dog, the quick brown fox jumps over the lazy cat"), 35);
+    EXPECT_EQ(str.FindLast("The quick brown fox jumps over the lazy dog, the"), 0);
+    EXPECT_EQ(str.Find("quick brown fox jumps over the lazy cow"), -1);
+    EXPECT_EQ(str.FindLast("lazy cow"), -1);
+    EXPECT_EQ(str.Find(""), 0);
+    EXPECT_EQ(str.FindLast(""), static_cast<SSize>(str.Size()));
+    EXPECT_TRUE(str.Contains("brown fox"));
+    EXPECT_FALSE(str.Contains("red fox"));
+    EXPECT_EQ(StringSlice("ab").Find("abc"), -1);
+
+    const String multibyte = "абв€где€€ж€";
+    EXPECT_EQ(multibyte.Find("€€"), 15);
+    EXPECT_EQ(multibyte.FindLast("€"), 23);
+}
+
+TEST(Strings, FindSubstringWorstCase)
+{
+    // Every position is a candidate for the SIMD filter, the search must fall back to Two-Way.
+    String str(5000, 'a');
+    const String needle = String(20, 'a') + "b";
+    EXPECT_EQ(str.Find(needle), -1);
+    EXPECT_EQ(str.FindLast(needle), -1);
+    EXPECT_EQ(str.Find(String(20, 'a')), 0);
+    EXPECT_EQ(str.FindLast(String(20, 'a')), 4980);
+
+    str += needle;
+    str += String(5000, 'a');
+    EXPECT_EQ(str.Find(needle), 5000);
+    EXPECT_EQ(str.FindLast(needle), 5000);
+    EXPECT_EQ(str.Count(needle), 1);
+
+    const String periodic = String(100, 'a') + "b" + String(100, 'a') + "b";
+    EXPECT_EQ(str.Find(periodic), -1);
+    EXPECT_EQ(str.FindLast(periodic), -1);
+    EXPECT_EQ(str.Find(String(100, 'a') + "b"), 4920);
+    EXPECT_EQ(str.FindLast("b" + String(100, 'a')), 5020);
+}
+
+TEST(Strings, FindSubstringRandom)
+{
+    // Small alphabets produce a lot of partial matches and periodic needles.
+    std::mt19937 rng(42);
+    for (int iteration = 0; iteration < 2000; ++iteration)
+    {
+        const char alphabetSize = static_cast<char>(2 + iteration % 3);
+        auto randomString       = [&](USize size) {
+            std::string result(size, 'a');
+            for (auto& c : result)
+            {
+                c = static_cast<char>('a' + rng() % alphabetSize);
+            }
+
+            return result;
+        };
+
+        const std::string haystack = randomString(iteration % 100 == 0 ? 20000 : rng() % 300);
+        const std::string needle   = iteration % 5 == 0 && haystack.size() > 10
+              ? haystack.substr(rng() % (haystack.size() - 10), 1 + rng() % 80)
+              : randomString(1 + rng() % 70);
+
+        const StringSlice slice(haystack.data(), haystack.size());
+        const StringSlice search(needle.data(), needle.size());
+        const auto expectedFirst = haystack.find(needle);
+        const auto expectedLast  = haystack.rfind(needle);
+        ASSERT_EQ(slice.Find(search), expectedFirst == std::string::npos ? -1 : static_cast<SSize>(expectedFirst))
+            << haystack << " / " << needle;
+        ASSERT_EQ(slice.FindLast(search), expectedLast == std::string::npos ? -1 : static_cast<SSize>(expectedLast))
+            << haystack << " / " << needle;
+
+        USize expectedCount = 0;
+        for (auto index = haystack.find(needle); index != std::string::npos; index = haystack.find(needle, index + needle.size()))
+        {
+            ++expectedCount;
+        }
+
+        ASSERT_EQ(slice.Count(search), expectedCount) << haystack << " / " << needle;
+    }
+}
+
+TEST(Strings, SplitSubstring)
+{
+    const String str = "one, two, , three, ";
+    auto split       = str.Split(", ");
+    ASSERT_EQ(split.Size(), 4);
+    EXPECT_EQ(split[0], StringSlice("one"));
+    EXPECT_EQ(split[1], StringSlice("two"));
+    EXPECT_EQ(split[2], StringSlice(""));
+    EXPECT_EQ(split[3], StringSlice("three"));
+
+    EXPECT_EQ(StringSlice("abc").Split("abcd").Size(), 1);
+    EXPECT_EQ(StringSlice("").Split("--").Size(), 0);
+    EXPECT_EQ(str.Count(", "), 4);
+    EXPECT_EQ(StringSlice("aaaaa").Count("aa"), 2);
+}
+
+namespace
+{
+    void ExpectSameParts(const List<StringSlice>& actual, const List<StringSlice>& expected)
+    {
+        ASSERT_EQ(actual.Size(), expected.Size());
+        for (USize i = 0; i < actual.Size(); ++i)
+        {
+            EXPECT_EQ(actual[i], expected[i]);
+        }
+    }
+} // namespace
+
+TEST(Strings, SplitIter)
+{
+    auto collect = [](StringSplitRange range) {
+        List<StringSlice> result;
+        for (StringSlice part : range)
+        {
+            result.Emplace(part);
+        }
+
+        return result;
+    };
+
+    // Without options the parts must be the same as the ones from Split.
+    for (const StringSlice str : { "", ",", "a", ",a,,b,", "абв€где€€ж€", "loooooooooooooooooooooooooooooooooooong,,x" })
+    {
+        ExpectSameParts(collect(str.SplitIter(',')), str.Split(','));
+        ExpectSameParts(collect(str.SplitIter(U'€')), str.Split(U'€'));
+        ExpectSameParts(collect(str.SplitIter(",")), str.Split(','));
+        ExpectSameParts(collect(str.SplitIter(",,")), str.Split(",,"));
+    }
+
+    const StringSlice str = ",one,,two,three,,";
+    auto parts            = collect(str.SplitIter(',', SplitOptions::SkipEmpty));
+    ASSERT_EQ(parts.Size(), 3);
+    EXPECT_EQ(parts[0], StringSlice("one"));
+    EXPECT_EQ(parts[1], StringSlice("two"));
+    EXPECT_EQ(parts[2], StringSlice("three"));
+
+    parts = collect(str.SplitIter(',', SplitOptions::None, 2));
+    ASSERT_EQ(parts.Size(), 3);
+    EXPECT_EQ(parts[0], StringSlice(""));
+    EXPECT_EQ(parts[1], StringSlice("one"));
+    EXPECT_EQ(parts[2], StringSlice(",two,three,,"));
+
+    parts = collect(str.SplitIter(',', SplitOptions::SkipEmpty, 1));
+    ASSERT_EQ(parts.Size(), 2);
+    EXPECT_EQ(parts[0], StringSlice("one"));
+    EXPECT_EQ(parts[1], StringSlice("two,three,,"));
+
+    parts = collect(StringSlice("key = value = x").SplitIter(" = ", SplitOptions::None, 1));
+    ASSERT_EQ(parts.Size(), 2);
+    EXPECT_EQ(parts[0], StringSlice("key"));
+    EXPECT_EQ(parts[1], StringSlice("value = x"));
+
+    EXPECT_EQ(collect(StringSlice("abc").SplitIter(',', SplitOptions::None, 0)).Size(), 1);
+    EXPECT_EQ(collect(StringSlice(",,,").SplitIter(',', SplitOptions::SkipEmpty)).Size(), 0);
+    EXPECT_EQ(collect(StringSlice("a,b").SplitIter(static_cast<TCodepoint>(0x110000))).Size(), 1);
+
+    // Only the used part of the string is scanned.
+    auto range = StringSlice("2024-05-17 12:00:00 INFO message").SplitIter(' ');
+    auto iter  = range.begin();
+    EXPECT_EQ(*iter, StringSlice("2024-05-17"));
+    EXPECT_EQ(*++iter, StringSlice("12:00:00"));
+    EXPECT_NE(iter, range.end());
+}
+
+TEST(Strings, LinesIter)
+{
+    const String text = "first\r\n\nsecond line\r\n\r\nthird line is longer than thirty-two bytes\n";
+    List<StringSlice> lines;
+    for (StringSlice line : text.LinesIter())
+    {
+        lines.Emplace(line);
+    }
+
+    ExpectSameParts(lines, text.SplitLines());
+
+    lines.Clear();
+    for (StringSlice line : text.LinesIter(SplitOptions::SkipEmpty))
+    {
+        lines.Emplace(line);
+    }
+
+    ASSERT_EQ(lines.Size(), 3);
+    EXPECT_EQ(lines[0], StringSlice("first"));
+    EXPECT_EQ(lines[1], StringSlice("second line"));
+    EXPECT_EQ(lines[2], StringSlice("third line is longer than thirty-two bytes"));
+}
+
+TEST(Strings, Replace)
+{
+    String str = "one two one two one";
+    EXPECT_TRUE(str.Replace("two", "2"));
+    EXPECT_EQ(str, StringSlice("one 2 one two one"));
+    EXPECT_FALSE(str.Replace("three", "3"));
+
+    EXPECT_EQ(str.ReplaceAll("one", "three"), 3);
+    EXPECT_EQ(str, StringSlice("three 2 three two three"));
+    EXPECT_EQ(str.ReplaceAll("four", "4"), 0);
+    EXPECT_EQ(str, StringSlice("three 2 three two three"));
+
+    // The replacement points into the string itself.
+    EXPECT_EQ(str.ReplaceAll(" ", StringSlice(str.Data(), 5)), 4);
+    EXPECT_EQ(str, StringSlice("threethree2threethreethreetwothreethree"));
+
+    String aaa = "aaaa";
+    EXPECT_EQ(aaa.ReplaceAll("aa", "b"), 2);
+    EXPECT_EQ(aaa, StringSlice("bb"));
+}
+
 TEST(Strings, Strip)
 {
     EXPECT_EQ(String("123").Strip(), StringSlice("123"));
@@ -295,3 +588,33 @@ TEST(Strings, Parse)
     EXPECT_EQ(String("0").Parse<bool>().Unwrap(), false);
     EXPECT_EQ(String("1").Parse<bool>().Unwrap(), true);
 }
+
+TEST(Strings, CustomAllocator)
+{
+    TrackingAllocator allocator;
+    {
+        String str(&allocator);
+        EXPECT_EQ(str.GetAllocator(), &allocator);
+        str.Append("a string that is too long to fit into the small string buffer");
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 1);
+
+        String copy = str;
+        EXPECT_EQ(copy.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        String moved = std::move(copy);
+        EXPECT_EQ(moved.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 2);
+
+        String concat = str + "!";
+        EXPECT_EQ(concat.GetAllocator(), &allocator);
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 3);
+
+        String system = "short";
+        system        = str;
+        EXPECT_EQ(system.GetAllocator(), SystemAllocator::Get());
+        EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 3);
+    }
+
+    EXPECT_EQ(allocator.GetStats().LiveAllocationCount(), 0);
+}
@@ -0,0 +1,159 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Strings/String.h>
+#include <UnTL/Strings/Transcode.h>
+#include <string>
+
+using namespace UN;
+
+namespace
+{
+    std::u32string DecodeReference(const std::string& str)
+    {
+        std::u32string result;
+        const char* it  = str.data();
+        const char* end = it + str.size();
+        while (it < end)
+        {
+            result += UTF8::Decode(it);
+        }
+
+        return result;
+    }
+
+    std::u16string ToUtf16(const std::string& str)
+    {
+        std::u16string result(UTF8::GetUtf16Length({ str.data(), str.size() }), u'\0');
+        EXPECT_EQ(UTF8::TranscodeToUtf16({ str.data(), str.size() }, { result.data(), result.size() }), result.size());
+        return result;
+    }
+
+    std::u32string ToUtf32(const std::string& str)
+    {
+        std::u32string result(UTF8::GetUtf32Length({ str.data(), str.size() }), U'\0');
+        EXPECT_EQ(UTF8::TranscodeToUtf32({ str.data(), str.size() }, { result.data(), result.size() }), result.size());
+        return result;
+    }
+
+    std::string FromUtf16(const std::u16string& str)
+    {
+        std::string result(UTF8::GetLengthFromUtf16({ str.data(), str.size() }), '\0');
+        EXPECT_EQ(UTF8::TranscodeFromUtf16({ str.data(), str.size() }, { result.data(), result.size() }), result.size());
+        return result;
+    }
+
+    std::string FromUtf32(const std::u32string& str)
+    {
+        std::string result(UTF8::GetLengthFromUtf32({ str.data(), str.size() }), '\0');
+        EXPECT_EQ(UTF8::TranscodeFromUtf32({ str.data(), str.size() }, { result.data(), result.size() }), result.size());
+        return result;
+    }
+} // namespace
+
+TEST(Transcode, Ascii)
+{
+    const std::string text = "The quick brown fox jumps over the lazy dog, 0123456789!";
+    EXPECT_EQ(ToUtf16(text), u"The quick brown fox jumps over the lazy dog, 0123456789!");
+    EXPECT_EQ(ToUtf32(text), U"The quick brown fox jumps over the lazy dog, 0123456789!");
+    EXPECT_EQ(FromUtf16(ToUtf16(text)), text);
+    EXPECT_EQ(FromUtf32(ToUtf32(text)), text);
+
+    EXPECT_EQ(ToUtf16(""), u"");
+    EXPECT_EQ(FromUtf32(U""), "");
+}
+
+TEST(Transcode, Mixed)
+{
+    const std::string text = "aЯ€😀";
+    EXPECT_EQ(ToUtf16(text), u"aЯ€😀");
+    EXPECT_EQ(ToUtf32(text), U"aЯ€😀");
+    EXPECT_EQ(ToUtf16(text).size(), 5);
+    EXPECT_EQ(FromUtf16(u"aЯ€😀"), text);
+    EXPECT_EQ(FromUtf32(U"aЯ€😀"), text);
+}
+
+TEST(Transcode, RoundTrip)
+{
+    // Mix ASCII runs of all lengths with multibyte codepoints to cross the SIMD block boundaries.
+    const char* codepoints[] = { "Я", "€", "😀", "\x7f", "\xc2\x80", "\xef\xbf\xbf", "\xf4\x8f\xbf\xbf" };
+    std::string text;
+    for (USize i = 0; i < 200; ++i)
+    {
+        text.append(i % 37, static_cast<char>('a' + i % 26));
+        text += codepoints[i % std::size(codepoints)];
+
+        const std::u32string expected = DecodeReference(text);
+        const std::u16string utf16    = ToUtf16(text);
+        const std::u32string utf32    = ToUtf32(text);
+        ASSERT_EQ(utf32, expected);
+        ASSERT_EQ(FromUtf16(utf16), text);
+        ASSERT_EQ(FromUtf32(utf32), text);
+    }
+}
+
+TEST(Transcode, InvalidInput)
+{
+    // Unpaired surrogates and values out of range are replaced with U+FFFD.
+    const std::u16string utf16 = u"a\xd800" u"b\xdc00";
+    std::string result(16, '\0');
+    result.resize(UTF8::TranscodeFromUtf16({ utf16.data(), utf16.size() }, { result.data(), result.size() }));
+    EXPECT_EQ(result, "a\xef\xbf\xbd" "b\xef\xbf\xbd");
+
+    const std::u32string utf32 = U"a" + std::u32string(1, static_cast<char32_t>(0x110000));
+    result.resize(16);
+    result.resize(UTF8::TranscodeFromUtf32({ utf32.data(), utf32.size() }, { result.data(), result.size() }));
+    EXPECT_EQ(result, "a\xef\xbf\xbd");
+
+    // A truncated sequence at the end is a single maximal subpart.
+    const std::string truncated = "ab\xe2\x82";
+    std::u32string decoded(8, U'\0');
+    decoded.resize(UTF8::TranscodeToUtf32({ truncated.data(), truncated.size() }, { decoded.data(), decoded.size() }));
+    EXPECT_EQ(decoded, U"ab\xfffd");
+}
+
+TEST(Transcode, InvalidUtf8)
+{
+    // Every maximal subpart of an ill-formed sequence becomes one U+FFFD (Unicode Standard, section 3.9).
+    // The expected strings only contain BMP codepoints, so they are the same in UTF-16 and UTF-32.
+    const auto expect = [](const std::string& bytes, const std::u32string& expected) {
+        std::u32string utf32(bytes.size(), U'\0');
+        utf32.resize(UTF8::TranscodeToUtf32({ bytes.data(), bytes.size() }, { utf32.data(), utf32.size() }));
+        EXPECT_EQ(utf32, expected);
+
+        std::u16string utf16(bytes.size() * 2, u'\0');
+        utf16.resize(UTF8::TranscodeToUtf16({ bytes.data(), bytes.size() }, { utf16.data(), utf16.size() }));
+        EXPECT_EQ(utf16, std::u16string(expected.begin(), expected.end()));
+    };
+
+    expect("\xc0\xaf", U"\xfffd\xfffd");                      // overlong
+    expect("\xe0\x80\xaf", U"\xfffd\xfffd\xfffd");            // overlong
+    expect("\xed\xa0\x80", U"\xfffd\xfffd\xfffd");            // surrogate
+    expect("\xf4\x90\x80\x80", U"\xfffd\xfffd\xfffd\xfffd");  // above U+10FFFF
+    expect("\xf7\xbf\xbf\xbf", U"\xfffd\xfffd\xfffd\xfffd");  // invalid lead
+    expect("\xc3\x41", U"\xfffd" U"A");                       // the next valid byte is not consumed
+    expect("\xe2\x82\x41\xe2\x82\xac", U"\xfffd" U"A\x20ac"); // incomplete 3-byte sequence
+    expect("\xf0\x9f\x98\xd0\x91", U"\xfffd\x0411");          // incomplete 4-byte sequence
+    expect("\x80\xbf", U"\xfffd\xfffd");                      // stray continuation bytes
+    expect("\xed\x9f\xbf\xf4\x8f\xbf", U"\xd7ff\xfffd");      // the last codepoint before the surrogates
+}
+
+TEST(Transcode, SmallDestination)
+{
+    const std::string text(100, 'x');
+    char16_t buffer[10];
+    EXPECT_EQ(UTF8::TranscodeToUtf16({ text.data(), text.size() }, buffer), 10);
+
+    // A surrogate pair doesn't fit into one unit.
+    const std::string emoji = "😀";
+    EXPECT_EQ(UTF8::TranscodeToUtf16({ emoji.data(), emoji.size() }, { buffer, 1 }), 0);
+
+    const std::u32string wide = U"ЯЯЯ";
+    char bytes[5];
+    EXPECT_EQ(UTF8::TranscodeFromUtf32({ wide.data(), wide.size() }, bytes), 4);
+}
+
+TEST(Transcode, WideString)
+{
+    const String str = "loooooooooooooooooooooooooooooooooooong qЯwgЫЧ 😀";
+    const WString wide = str.ToWideString();
+    EXPECT_EQ(std::wstring(wide.begin(), wide.end()), L"loooooooooooooooooooooooooooooooooooong qЯwgЫЧ 😀");
+}
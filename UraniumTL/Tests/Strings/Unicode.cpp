@@ -0,0 +1,146 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Strings/String.h>
+#include <random>
+#include <string>
+
+using namespace UN;
+
+namespace
+{
+    bool ValidateAll(const std::string& str)
+    {
+        const auto* pData  = reinterpret_cast<const UInt8*>(str.data());
+        const bool result = UTF8::Internal::ValidateScalar(pData, str.size());
+#if UN_SSE41_SUPPORTED
+        EXPECT_EQ(UTF8::Internal::Utf8Validator<UTF8::Internal::Sse41Utf8Ops>::Validate(pData, str.size()), result) << str;
+#endif
+#if UN_AVX2_SUPPORTED
+        EXPECT_EQ(UTF8::Internal::Utf8Validator<UTF8::Internal::Avx2Utf8Ops>::Validate(pData, str.size()), result) << str;
+#endif
+        EXPECT_EQ(UTF8::Valid(str.data(), str.size()), result);
+        return result;
+    }
+
+    // Put the sequence at every offset of a 64-byte ASCII string to cross block boundaries.
+    void ExpectValidAtAllOffsets(const std::string& sequence, bool expected)
+    {
+        for (USize offset = 0; offset <= 64; ++offset)
+        {
+            std::string str(offset, 'a');
+            str += sequence;
+            str.append(64 - offset, 'b');
+            EXPECT_EQ(ValidateAll(str), expected) << "offset " << offset;
+
+            // The sequence at the very end.
+            EXPECT_EQ(ValidateAll(std::string(offset, 'a') + sequence), expected) << "offset " << offset;
+        }
+    }
+} // namespace
+
+TEST(Unicode, ValidSequences)
+{
+    EXPECT_TRUE(ValidateAll(""));
+    EXPECT_TRUE(ValidateAll("hello"));
+    ExpectValidAtAllOffsets("\x7f", true);
+    ExpectValidAtAllOffsets("\xc2\x80", true);             // U+0080
+    ExpectValidAtAllOffsets("\xdf\xbf", true);             // U+07FF
+    ExpectValidAtAllOffsets("\xe0\xa0\x80", true);         // U+0800
+    ExpectValidAtAllOffsets("\xed\x9f\xbf", true);         // U+D7FF
+    ExpectValidAtAllOffsets("\xee\x80\x80", true);         // U+E000
+    ExpectValidAtAllOffsets("\xef\xbf\xbf", true);         // U+FFFF
+    ExpectValidAtAllOffsets("\xf0\x90\x80\x80", true);     // U+10000
+    ExpectValidAtAllOffsets("\xf4\x8f\xbf\xbf", true);     // U+10FFFF
+    ExpectValidAtAllOffsets("qЯwgЫЧ", true);
+}
+
+TEST(Unicode, InvalidSequences)
+{
+    ExpectValidAtAllOffsets("\x80", false);                 // lone continuation
+    ExpectValidAtAllOffsets("\xc2", false);                 // truncated
+    ExpectValidAtAllOffsets("\xe0\xa0", false);             // truncated
+    ExpectValidAtAllOffsets("\xf0\x90\x80", false);         // truncated
+    ExpectValidAtAllOffsets("\xc2\x80\x80", false);         // too long
+    ExpectValidAtAllOffsets("\xc0\x80", false);             // overlong
+    ExpectValidAtAllOffsets("\xc1\xbf", false);             // overlong
+    ExpectValidAtAllOffsets("\xe0\x9f\xbf", false);         // overlong
+    ExpectValidAtAllOffsets("\xf0\x8f\xbf\xbf", false);     // overlong
+    ExpectValidAtAllOffsets("\xed\xa0\x80", false);         // surrogate
+    ExpectValidAtAllOffsets("\xed\xbf\xbf", false);         // surrogate
+    ExpectValidAtAllOffsets("\xf4\x90\x80\x80", false);     // above U+10FFFF
+    ExpectValidAtAllOffsets("\xf5\x80\x80\x80", false);     // above U+10FFFF
+    ExpectValidAtAllOffsets("\xf8\x88\x80\x80\x80", false); // 5-byte sequence
+    ExpectValidAtAllOffsets("\xff", false);
+    ExpectValidAtAllOffsets("\xe2\x82\x41", false);         // ASCII in a 3-byte sequence
+}
+
+TEST(Unicode, ValidRandom)
+{
+    // Corrupt random bytes of valid text and check that all the validators agree.
+    const std::string text = "Съешь же ещё этих мягких французских булок, да выпей чаю. 😀 ∮ E⋅da = Q, n → ∞";
+    ASSERT_TRUE(ValidateAll(text));
+
+    std::mt19937 mt(7);
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string corrupted = text;
+        corrupted[mt() % corrupted.size()] = static_cast<char>(mt());
+        ValidateAll(corrupted);
+    }
+}
+
+TEST(Unicode, ValidNullTerminated)
+{
+    EXPECT_TRUE(UTF8::Valid("qЯwgЫЧ"));
+    EXPECT_FALSE(UTF8::Valid("\xd0 abc"));
+    EXPECT_FALSE(UTF8::Valid("abc \xd0"));
+}
+
+TEST(Unicode, Length)
+{
+    std::string str;
+    USize expected = 0;
+    for (int i = 0; i < 20; ++i)
+    {
+        EXPECT_EQ(UTF8::Length(str.data(), str.size()), expected);
+        str += "aЯ€😀";
+        expected += 4;
+    }
+
+    // The length must not read past the end of a slice.
+    const char* pText = "ЯЯЯЯ";
+    EXPECT_EQ(StringSlice(pText, 4).Length(), 2);
+
+    EXPECT_EQ(String("loooooooooooooooooooooooooooooooooooong qЯwgЫЧ").Length(), 46);
+}
+
+TEST(Unicode, Advance)
+{
+    std::string str;
+    for (int i = 0; i < 20; ++i)
+    {
+        str += "aЯ€😀";
+    }
+
+    const char* pEnd = str.data() + str.size();
+    for (USize n = 0; n <= 80; ++n)
+    {
+        const char* it = str.data();
+        UTF8::Advance(it, pEnd, n);
+
+        const char* expected = str.data();
+        for (USize i = 0; i < n; ++i)
+        {
+            UTF8::Decode(expected);
+        }
+
+        EXPECT_EQ(it, expected) << n;
+    }
+
+    const char* it = str.data();
+    UTF8::Advance(it, pEnd, 1000);
+    EXPECT_EQ(it, pEnd);
+
+    const String utf8 = "loooooooooooooooooooooooooooooooooooong qЯwgЫЧ";
+    EXPECT_EQ(utf8(40, 44), StringSlice(utf8.Data() + 40, 5));
+    EXPECT_EQ(StringSlice(utf8)(41, 46), StringSlice(utf8.Data() + 41, 8));
+}
@@ -0,0 +1,46 @@
+#include <Tests/Common/Common.h>
+#include <UnTL/Utils/BitUtils.h>
+#include <vector>
+
+using namespace UN;
+
+TEST(BitUtils, CountZeros64)
+{
+    EXPECT_EQ(Bits::CountTrailingZeros(static_cast<UInt64>(1)), 0);
+    EXPECT_EQ(Bits::CountTrailingZeros(static_cast<UInt64>(1) << 40), 40);
+    EXPECT_EQ(Bits::CountTrailingZeros(static_cast<UInt64>(0x8000000000000000ull)), 63);
+
+    EXPECT_EQ(Bits::CountLeadingZeros(static_cast<UInt64>(1)), 63);
+    EXPECT_EQ(Bits::CountLeadingZeros(static_cast<UInt64>(1) << 40), 23);
+    EXPECT_EQ(Bits::CountLeadingZeros(static_cast<UInt64>(0x8000000000000000ull)), 0);
+}
+
+TEST(BitUtils, PopCount)
+{
+    EXPECT_EQ(Bits::PopCount(static_cast<UInt32>(0)), 0);
+    EXPECT_EQ(Bits::PopCount(static_cast<UInt32>(0xffffffff)), 32);
+    EXPECT_EQ(Bits::PopCount(static_cast<UInt32>(0b1011001)), 4);
+
+    EXPECT_EQ(Bits::PopCount(static_cast<UInt64>(0)), 0);
+    EXPECT_EQ(Bits::PopCount(~static_cast<UInt64>(0)), 64);
+    EXPECT_EQ(Bits::PopCount(static_cast<UInt64>(0x8000000100000001ull)), 3);
+}
+
+TEST(BitUtils, ForEachSetBit)
+{
+    EXPECT_EQ(Bits::ResetLowestSetBit(static_cast<UInt32>(0b10110)), 0b10100);
+
+    std::vector<UInt32> bits;
+    Bits::ForEachSetBit(static_cast<UInt64>(0x8000000000010005ull), [&](UInt32 bit) {
+        bits.push_back(bit);
+    });
+
+    EXPECT_EQ(bits, (std::vector<UInt32>{ 0, 2, 16, 63 }));
+
+    bits.clear();
+    Bits::ForEachSetBit(static_cast<UInt32>(0), [&](UInt32 bit) {
+        bits.push_back(bit);
+    });
+
+    EXPECT_TRUE(bits.empty());
+}
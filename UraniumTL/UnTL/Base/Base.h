@@ -6,6 +6,7 @@
 #include <cstring>
 #include <string_view>
 #include <memory>
+#include <type_traits>
 #include <xmmintrin.h>
 #include <emmintrin.h>
 
@@ -92,6 +93,27 @@ namespace UN
     //! \brief Maximum alignment value, should be enough for anything
     inline constexpr USize MaximumAlignment = 16;
 
+    //! \brief Size of a CPU cache line, used to avoid false sharing between threads.
+    inline constexpr USize CacheLineSize = 64;
+
+    //! \brief Check if objects of type T can be moved to another address with memcpy.
+    //!
+    //! Relocating an object means move-constructing a new object from it and destroying the old one.
+    //! For trivially relocatable types this is equivalent to copying the bytes and forgetting the old object,
+    //! which lets containers grow, insert and remove elements with memcpy/memmove.\n
+    //! Trivially copyable types are always trivially relocatable. Specialize this template for other types
+    //! that don't store pointers to themselves and don't register their address anywhere, e.g.:
+    //! \code{.cpp}
+    //!     template<class T>
+    //!     struct IsTriviallyRelocatable<List<T>> : std::true_type
+    //!     {
+    //!     };
+    //! \endcode
+    template<class T>
+    struct IsTriviallyRelocatable : std::is_trivially_copyable<T>
+    {
+    };
+
     //! \brief Align up an integer.
     //!
     //! \param x     - Value to align.
@@ -10,6 +10,10 @@
 
 #define UN_MAKE_STR(txt) #txt
 
+#if defined _MSC_VER
+#    include <intrin.h>
+#endif
+
 #if defined __clang__
 #    define UN_COMPILER_CLANG 1
 
@@ -24,6 +28,7 @@
 #    define UN_POP_CLANG_WARNING _Pragma("clang diagnostic pop")
 
 #    define UN_PRETTY_FUNCTION __PRETTY_FUNCTION__
+#    define UN_ReturnAddress() __builtin_return_address(0)
 
 #    ifndef UN_FINLINE
 #        define UN_FINLINE inline
@@ -38,6 +43,7 @@
 #    define UN_POP_CLANG_WARNING
 
 #    define UN_PRETTY_FUNCTION __FUNCSIG__
+#    define UN_ReturnAddress() _ReturnAddress()
 
 #    ifndef UN_FINLINE
 #        define UN_FINLINE __forceinline
@@ -12,6 +12,7 @@
 
 #    define UN_AlignedMalloc(size, alignment) _aligned_malloc(size, alignment)
 #    define UN_AlignedFree(ptr) _aligned_free(ptr)
+#    define UN_AlignedRealloc(ptr, size, alignment) _aligned_realloc(ptr, size, alignment)
 
 #    define UN_ByteSwapUInt16(value) _byteswap_ushort(value)
 #    define UN_ByteSwapUInt32(value) _byteswap_ulong(value)
@@ -30,6 +31,9 @@
 
 #    define UN_AlignedMalloc(size, alignment) ::memalign(alignment, size)
 #    define UN_AlignedFree(ptr) ::free(ptr)
+// realloc() only guarantees the alignment of malloc(), check for UN_AlignedReallocMaxAlignment before use.
+#    define UN_AlignedRealloc(ptr, size, alignment) ::realloc(ptr, size)
+#    define UN_AlignedReallocMaxAlignment alignof(max_align_t)
 
 #    define UN_ByteSwapUInt16(value) __builtin_bswap16(value)
 #    define UN_ByteSwapUInt32(value) __builtin_bswap32(value)
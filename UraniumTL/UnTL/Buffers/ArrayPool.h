@@ -1,8 +1,11 @@
 #pragma once
+#include <UnTL/Buffers/Internal/LockFreePoolBucket.h>
 #include <UnTL/Buffers/Internal/PoolBucket.h>
+#include <UnTL/Buffers/Internal/PoolThreadCache.h>
 #include <UnTL/Containers/ArraySlice.h>
 #include <UnTL/Containers/HeapArray.h>
 #include <UnTL/Containers/List.h>
+#include <UnTL/Memory/Internal/ThreadCacheRegistry.h>
 #include <UnTL/Utils/BitUtils.h>
 
 namespace UN
@@ -12,38 +15,54 @@ namespace UN
     //! The class enables renting and returning arrays frequently while reducing
     //! the number of memory allocations by caching arrays with different sizes.
     //!
+    //! Each thread has a small per-bucket cache (a magazine) of arrays in front of the shared buckets.
+    //! Renting and returning arrays only locks a bucket when the magazine is empty or full, and in that
+    //! case the arrays are moved between the magazine and the bucket in batches. The magazines are only
+    //! used for arrays up to MaxMagazineArraySize bytes, larger arrays always go to the shared buckets.
+    //!
     //! \note The class is thread-safe.
     //!
-    //! \tparam T - Type of array element, must be trivially destructible.
+    //! \tparam T     - Type of array element, must be trivially destructible.
+    //! \tparam TLock - Type of lock that guards the shared buckets. Pass LockFreeTag to use lock-free buckets.
     template<class T, class TLock = std::mutex>
     class ArrayPool final : public Object<IObject>
     {
-        using PoolBucket = Internal::PoolBucket<T, TLock>;
+        using PoolBucket  = Internal::PoolBucket<T, TLock>;
+        using ThreadCache = Internal::PoolThreadCache<T>;
 
         inline static constexpr USize DefaultMaxArrayLength         = 1024 * 1024;
         inline static constexpr USize DefaultMaxArrayCountPerBucket = 50;
+        inline static constexpr USize DefaultMagazineCapacity       = 16;
+        inline static constexpr USize MaxMagazineArraySize          = 64 * 1024;
+        inline static constexpr USize LargeArraySize                = 256 * 1024;
+
+        static_assert(LargeArraySize > MaxMagazineArraySize);
 
         static_assert(std::is_trivially_destructible_v<T> && !std::is_const_v<T>);
 
         ArraySlice<PoolBucket> m_Buckets;
         IAllocator* m_pAllocator;
+        IAllocator* m_pLargeArrayAllocator;
+        USize m_MagazineCapacity;
+        USize m_MagazineBucketCount;
+        Internal::ThreadCacheRegistry<ThreadCache> m_ThreadCaches;
 
         template<class TItem>
-        UN_FINLINE ArraySlice<TItem> AllocateStorage(USize length)
+        UN_FINLINE ArraySlice<TItem> AllocateStorage(USize length, IAllocator* pAllocator)
         {
-            void* pData = m_pAllocator->Allocate(length * sizeof(TItem), alignof(TItem));
+            void* pData = pAllocator->Allocate(length * sizeof(TItem), alignof(TItem));
             return ArraySlice<TItem>(static_cast<TItem*>(pData), length);
         }
 
         template<class TItem>
-        UN_FINLINE void DeallocateStorage(const ArraySlice<TItem>& storage)
+        UN_FINLINE void DeallocateStorage(const ArraySlice<TItem>& storage, IAllocator* pAllocator)
         {
             if (storage.Empty())
             {
                 return;
             }
 
-            m_pAllocator->Deallocate(storage.Data());
+            pAllocator->Deallocate(storage.Data(), storage.Length() * sizeof(TItem), alignof(TItem));
         }
 
         inline UInt32 Log2(UInt32 x)
@@ -61,6 +80,45 @@ namespace UN
             return 16 << static_cast<Int32>(binIndex);
         }
 
+        //! Magazine arrays are always smaller than LargeArraySize, so they are allocated with m_pAllocator.
+        inline IAllocator* GetArrayAllocator(USize length)
+        {
+            return length * sizeof(T) >= LargeArraySize ? m_pLargeArrayAllocator : m_pAllocator;
+        }
+
+        //! Return the arrays cached by an exiting thread to the shared buckets.
+        inline static void ReclaimThreadCache(void* pOwner, ThreadCache& cache)
+        {
+            auto* pool = static_cast<ArrayPool*>(pOwner);
+            for (USize i = 0; i < pool->m_MagazineBucketCount; ++i)
+            {
+                cache.Flush(i, pool->m_Buckets[i], pool->m_MagazineCapacity);
+            }
+        }
+
+        UN_FINLINE ThreadCache& GetThreadCache()
+        {
+            return m_ThreadCaches.Get(m_pAllocator, m_MagazineBucketCount, m_MagazineCapacity);
+        }
+
+        inline ArraySlice<T> RentFromBuckets(USize index)
+        {
+            const auto MaxBucketsToTry = 2;
+
+            auto i = index;
+            do
+            {
+                auto buffer = m_Buckets[i].Rent();
+                if (buffer.Any())
+                {
+                    return buffer;
+                }
+            }
+            while (++i < m_Buckets.Length() && i != index + MaxBucketsToTry);
+
+            return m_Buckets[index].AllocateStorage();
+        }
+
     public:
         //! \brief Create a default instance of ArrayPool<T>.
         inline explicit ArrayPool(IAllocator* pAllocator)
@@ -70,7 +128,38 @@ namespace UN
 
         //! \brief Create a default instance of ArrayPool<T>.
         inline explicit ArrayPool(IAllocator* pAllocator, USize maxArrayLength, USize maxArrayCountPerBucket)
+            : ArrayPool(pAllocator, maxArrayLength, maxArrayCountPerBucket, DefaultMagazineCapacity)
+        {
+        }
+
+        //! \brief Create an instance of ArrayPool<T>.
+        //!
+        //! \param pAllocator             - The allocator to use for the arrays and internal data.
+        //! \param maxArrayLength         - The maximum length of an array that can be cached.
+        //! \param maxArrayCountPerBucket - The maximum number of arrays that a shared bucket can hold.
+        //! \param magazineCapacity       - The number of arrays a per-thread magazine can hold, zero disables them.
+        inline ArrayPool(IAllocator* pAllocator, USize maxArrayLength, USize maxArrayCountPerBucket, USize magazineCapacity)
+            : ArrayPool(pAllocator, pAllocator, maxArrayLength, maxArrayCountPerBucket, magazineCapacity)
+        {
+        }
+
+        //! \brief Create an instance of ArrayPool<T> with a separate allocator for large arrays.
+        //!
+        //! Arrays of LargeArraySize bytes and more are allocated with pLargeArrayAllocator, e.g. with
+        //! a VirtualMemoryAllocator, so that multi-megabyte buffers don't fragment the heap.
+        //!
+        //! \param pAllocator             - The allocator to use for smaller arrays and internal data.
+        //! \param pLargeArrayAllocator   - The allocator to use for large arrays.
+        //! \param maxArrayLength         - The maximum length of an array that can be cached.
+        //! \param maxArrayCountPerBucket - The maximum number of arrays that a shared bucket can hold.
+        //! \param magazineCapacity       - The number of arrays a per-thread magazine can hold, zero disables them.
+        inline ArrayPool(IAllocator* pAllocator, IAllocator* pLargeArrayAllocator, USize maxArrayLength,
+                         USize maxArrayCountPerBucket, USize magazineCapacity)
             : m_pAllocator(pAllocator)
+            , m_pLargeArrayAllocator(pLargeArrayAllocator)
+            , m_MagazineCapacity(magazineCapacity)
+            , m_MagazineBucketCount(0)
+            , m_ThreadCaches(pAllocator, &ArrayPool::ReclaimThreadCache, this)
         {
             const auto MinimumArrayLength = 0x10, MaximumArrayLength = 0x40000000;
             if (maxArrayLength > MaximumArrayLength)
@@ -83,17 +172,39 @@ namespace UN
             }
 
             auto maxBuckets = SelectBucketIndex(maxArrayLength);
-            m_Buckets       = AllocateStorage<PoolBucket>(maxBuckets + 1);
+            m_Buckets       = AllocateStorage<PoolBucket>(maxBuckets + 1, m_pAllocator);
             for (USize i = 0; i < maxBuckets + 1; ++i)
             {
-                new (&m_Buckets[i]) PoolBucket(pAllocator, GetMaxSizeForBucket(i), maxArrayCountPerBucket);
+                auto maxSize = GetMaxSizeForBucket(i);
+                new (&m_Buckets[i]) PoolBucket(m_pAllocator, GetArrayAllocator(maxSize), maxSize, maxArrayCountPerBucket);
+            }
+
+            if (m_MagazineCapacity > 0)
+            {
+                while (m_MagazineBucketCount < m_Buckets.Length()
+                       && GetMaxSizeForBucket(m_MagazineBucketCount) * sizeof(T) <= MaxMagazineArraySize)
+                {
+                    ++m_MagazineBucketCount;
+                }
             }
         }
 
         ~ArrayPool() override
         {
+            // Exiting threads must not flush their magazines to the buckets that are being destroyed.
+            m_ThreadCaches.Shutdown();
+            m_ThreadCaches.ForEach([this](ThreadCache& cache) {
+                for (USize i = 0; i < m_MagazineBucketCount; ++i)
+                {
+                    for (auto& buffer : cache.GetBuffers(i))
+                    {
+                        DeallocateStorage(buffer, m_pAllocator);
+                    }
+                }
+            });
+
             std::destroy(m_Buckets.begin(), m_Buckets.end());
-            DeallocateStorage(m_Buckets);
+            DeallocateStorage(m_Buckets, m_pAllocator);
             m_Buckets = {};
         }
 
@@ -118,27 +229,29 @@ namespace UN
                 return {};
             }
 
-            ArraySlice<T> buffer;
             auto index = SelectBucketIndex(length);
-            if (index < m_Buckets.Length())
+            if (index < m_MagazineBucketCount)
             {
-                const auto MaxBucketsToTry = 2;
+                ArraySlice<T> buffer;
+                auto& cache = GetThreadCache();
+                if (cache.TryPop(index, buffer))
+                {
+                    return buffer;
+                }
 
-                auto i = index;
-                do
+                if (cache.Refill(index, m_Buckets[index], m_MagazineCapacity / 2 + 1) > 0)
                 {
-                    buffer = m_Buckets[i].Rent();
-                    if (buffer.Any())
-                    {
-                        return buffer;
-                    }
+                    cache.TryPop(index, buffer);
+                    return buffer;
                 }
-                while (++i < m_Buckets.Length() && i != index + MaxBucketsToTry);
+            }
 
-                return m_Buckets[index].AllocateStorage();
+            if (index < m_Buckets.Length())
+            {
+                return RentFromBuckets(index);
             }
 
-            return AllocateStorage<T>(length);
+            return AllocateStorage<T>(length, GetArrayAllocator(length));
         }
 
         //! \brief Return a previously rented array.
@@ -159,13 +272,23 @@ namespace UN
             auto bucket     = SelectBucketIndex(array.Length());
             auto haveBucket = bucket < m_Buckets.Length();
 
-            if (haveBucket)
+            if (bucket < m_MagazineBucketCount)
+            {
+                UN_Assert(array.Length() == GetMaxSizeForBucket(bucket), "Incorrect bucket");
+                auto& cache = GetThreadCache();
+                if (!cache.TryPush(bucket, array))
+                {
+                    cache.Flush(bucket, m_Buckets[bucket], m_MagazineCapacity / 2 + 1);
+                    cache.TryPush(bucket, array);
+                }
+            }
+            else if (haveBucket)
             {
                 m_Buckets[bucket].Return(array);
             }
             else
             {
-                DeallocateStorage(array);
+                DeallocateStorage(array, GetArrayAllocator(array.Length()));
             }
         }
     };
@@ -0,0 +1,205 @@
+#pragma once
+#include <UnTL/Buffers/Internal/PoolBucket.h>
+
+namespace UN
+{
+    //! \brief Pass this tag instead of a lock type to ArrayPool to use lock-free buckets.
+    struct LockFreeTag
+    {
+    };
+} // namespace UN
+
+namespace UN::Internal
+{
+    //! \brief A lock-free implementation of PoolBucket.
+    //!
+    //! The bucket is a pair of bounded Treiber stacks over a fixed array of nodes: one holds the nodes
+    //! with cached buffers and the other holds the unused nodes. A stack head is a 64-bit value that packs
+    //! the index of the top node and a tag that is incremented on every update, which prevents the ABA problem.
+    template<class T>
+    class PoolBucket<T, LockFreeTag> final
+    {
+        inline static constexpr UInt32 NullIndex = 0xFFFFFFFF;
+
+        struct Node
+        {
+            T* pData = nullptr;
+            std::atomic<UInt32> Next{ NullIndex };
+        };
+
+        alignas(CacheLineSize) std::atomic<UInt64> m_FullHead;
+        alignas(CacheLineSize) std::atomic<UInt64> m_FreeHead;
+        alignas(CacheLineSize) ArraySlice<Node> m_Nodes;
+        IAllocator* m_pAllocator;
+        IAllocator* m_pBufferAllocator;
+        USize m_BufferLength;
+
+        UN_FINLINE static UInt64 MakeHead(UInt32 index, UInt32 tag)
+        {
+            return (static_cast<UInt64>(tag) << 32) | index;
+        }
+
+        UN_FINLINE static UInt32 GetIndex(UInt64 head)
+        {
+            return static_cast<UInt32>(head);
+        }
+
+        UN_FINLINE static UInt32 GetTag(UInt64 head)
+        {
+            return static_cast<UInt32>(head >> 32);
+        }
+
+        inline UInt32 Pop(std::atomic<UInt64>& head)
+        {
+            UInt64 oldHead = head.load(std::memory_order_acquire);
+            while (true)
+            {
+                UInt32 index = GetIndex(oldHead);
+                if (index == NullIndex)
+                {
+                    return NullIndex;
+                }
+
+                UInt32 next    = m_Nodes[index].Next.load(std::memory_order_relaxed);
+                UInt64 newHead = MakeHead(next, GetTag(oldHead) + 1);
+                if (head.compare_exchange_weak(oldHead, newHead, std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    return index;
+                }
+            }
+        }
+
+        inline void Push(std::atomic<UInt64>& head, UInt32 index)
+        {
+            UInt64 oldHead = head.load(std::memory_order_relaxed);
+            UInt64 newHead;
+            do
+            {
+                m_Nodes[index].Next.store(GetIndex(oldHead), std::memory_order_relaxed);
+                newHead = MakeHead(index, GetTag(oldHead) + 1);
+            }
+            while (!head.compare_exchange_weak(oldHead, newHead, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+    public:
+        inline PoolBucket(IAllocator* pAllocator, IAllocator* pBufferAllocator, USize bufferLength, USize bufferCount)
+            : m_FullHead(MakeHead(NullIndex, 0))
+            , m_FreeHead(MakeHead(NullIndex, 0))
+            , m_pAllocator(pAllocator)
+            , m_pBufferAllocator(pBufferAllocator)
+            , m_BufferLength(bufferLength)
+        {
+            UN_Assert(bufferCount < NullIndex, "Too many buffers per bucket");
+
+            void* pNodes = m_pAllocator->Allocate(bufferCount * sizeof(Node), alignof(Node));
+            m_Nodes      = ArraySlice<Node>(static_cast<Node*>(pNodes), bufferCount);
+            for (UInt32 i = 0; i < bufferCount; ++i)
+            {
+                new (&m_Nodes[i]) Node;
+                Push(m_FreeHead, i);
+            }
+        }
+
+        inline ~PoolBucket()
+        {
+            for (UInt32 index = Pop(m_FullHead); index != NullIndex; index = Pop(m_FullHead))
+            {
+                m_pBufferAllocator->Deallocate(m_Nodes[index].pData, m_BufferLength * sizeof(T), alignof(T));
+            }
+
+            std::destroy(m_Nodes.begin(), m_Nodes.end());
+            if (m_Nodes.Any())
+            {
+                m_pAllocator->Deallocate(m_Nodes.Data(), m_Nodes.Length() * sizeof(Node), alignof(Node));
+            }
+        }
+
+        UN_FINLINE ArraySlice<T> AllocateStorage()
+        {
+            void* pData = m_pBufferAllocator->Allocate(m_BufferLength * sizeof(T), alignof(T));
+            return ArraySlice<T>(static_cast<T*>(pData), m_BufferLength);
+        }
+
+        UN_FINLINE void DeallocateStorage(const ArraySlice<T>& storage)
+        {
+            if (storage.Empty())
+            {
+                return;
+            }
+
+            m_pBufferAllocator->Deallocate(storage.Data(), storage.Length() * sizeof(T), alignof(T));
+        }
+
+        inline ArraySlice<T> Rent()
+        {
+            UInt32 index = Pop(m_FullHead);
+            if (index == NullIndex)
+            {
+                return AllocateStorage();
+            }
+
+            T* pData = m_Nodes[index].pData;
+            Push(m_FreeHead, index);
+            return ArraySlice<T>(pData, m_BufferLength);
+        }
+
+        inline void Return(const ArraySlice<T>& buffer)
+        {
+            UN_Assert(buffer.Length() == m_BufferLength, "Incorrect bucket");
+
+            UInt32 index = Pop(m_FreeHead);
+            if (index == NullIndex)
+            {
+                DeallocateStorage(buffer);
+                return;
+            }
+
+            m_Nodes[index].pData = buffer.Data();
+            Push(m_FullHead, index);
+        }
+
+        //! \brief Rent multiple previously returned buffers at once.
+        //!
+        //! Unlike Rent() this function never allocates new buffers, it only takes the cached ones.
+        //!
+        //! \param buffers - The slice to write the rented buffers to.
+        //!
+        //! \return The number of rented buffers.
+        inline USize RentBatch(const ArraySlice<ArraySlice<T>>& buffers)
+        {
+            USize count = 0;
+            while (count < buffers.Length())
+            {
+                UInt32 index = Pop(m_FullHead);
+                if (index == NullIndex)
+                {
+                    break;
+                }
+
+                buffers[count++] = ArraySlice<T>(m_Nodes[index].pData, m_BufferLength);
+                Push(m_FreeHead, index);
+            }
+
+            return count;
+        }
+
+        //! \brief Return multiple buffers at once.
+        //!
+        //! The buffers that don't fit into the bucket are deallocated.
+        //!
+        //! \param buffers - The buffers to return.
+        inline void ReturnBatch(const ArraySlice<const ArraySlice<T>>& buffers)
+        {
+            for (const auto& buffer : buffers)
+            {
+                Return(buffer);
+            }
+        }
+
+        //! \brief Length of the buffers stored in this bucket.
+        [[nodiscard]] inline USize GetBufferLength() const
+        {
+            return m_BufferLength;
+        }
+    };
+} // namespace UN::Internal
@@ -12,15 +12,15 @@ namespace UN::Internal
         inline static constexpr USize Alignment = std::max(static_cast<USize>(16), alignof(T));
 
         HeapArray<ArraySlice<T>> m_Buffers;
-        IAllocator* m_pAllocator;
+        IAllocator* m_pBufferAllocator;
         USize m_BufferLength;
         USize m_Index;
         TLock m_Mutex;
 
     public:
-        inline PoolBucket(IAllocator* pAllocator, USize bufferLength, USize bufferCount)
+        inline PoolBucket(IAllocator* pAllocator, IAllocator* pBufferAllocator, USize bufferLength, USize bufferCount)
             : m_Buffers(pAllocator, bufferCount)
-            , m_pAllocator(pAllocator)
+            , m_pBufferAllocator(pBufferAllocator)
             , m_BufferLength(bufferLength)
             , m_Index(0)
         {
@@ -38,7 +38,7 @@ namespace UN::Internal
 
         UN_FINLINE ArraySlice<T> AllocateStorage()
         {
-            void* pData = m_pAllocator->Allocate(m_BufferLength * sizeof(T), alignof(T));
+            void* pData = m_pBufferAllocator->Allocate(m_BufferLength * sizeof(T), alignof(T));
             return ArraySlice<T>(static_cast<T*>(pData), m_BufferLength);
         }
 
@@ -49,7 +49,7 @@ namespace UN::Internal
                 return;
             }
 
-            m_pAllocator->Deallocate(storage.Data());
+            m_pBufferAllocator->Deallocate(storage.Data(), storage.Length() * sizeof(T), alignof(T));
         }
 
         inline ArraySlice<T> Rent()
@@ -97,5 +97,56 @@ namespace UN::Internal
                 DeallocateStorage(buffer);
             }
         }
+
+        //! \brief Rent multiple previously returned buffers at once.
+        //!
+        //! Unlike Rent() this function never allocates new buffers, it only takes the cached ones.
+        //!
+        //! \param buffers - The slice to write the rented buffers to.
+        //!
+        //! \return The number of rented buffers.
+        inline USize RentBatch(const ArraySlice<ArraySlice<T>>& buffers)
+        {
+            USize count = 0;
+
+            std::unique_lock lk(m_Mutex);
+            while (count < buffers.Length() && m_Index < m_Buffers.Length() && m_Buffers[m_Index].Any())
+            {
+                buffers[count++]     = m_Buffers[m_Index];
+                m_Buffers[m_Index++] = {};
+            }
+
+            return count;
+        }
+
+        //! \brief Return multiple buffers at once.
+        //!
+        //! The buffers that don't fit into the bucket are deallocated.
+        //!
+        //! \param buffers - The buffers to return.
+        inline void ReturnBatch(const ArraySlice<const ArraySlice<T>>& buffers)
+        {
+            USize count = 0;
+
+            {
+                std::unique_lock lk(m_Mutex);
+                while (count < buffers.Length() && m_Index != 0)
+                {
+                    UN_Assert(buffers[count].Length() == m_BufferLength, "Incorrect bucket");
+                    m_Buffers[--m_Index] = buffers[count++];
+                }
+            }
+
+            for (; count < buffers.Length(); ++count)
+            {
+                DeallocateStorage(buffers[count]);
+            }
+        }
+
+        //! \brief Length of the buffers stored in this bucket.
+        [[nodiscard]] inline USize GetBufferLength() const
+        {
+            return m_BufferLength;
+        }
     };
 } // namespace UN::Internal
@@ -0,0 +1,90 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Containers/HeapArray.h>
+
+namespace UN::Internal
+{
+    //! \brief A per-thread cache of ArrayPool buffers.
+    //!
+    //! The cache holds a small LIFO (a magazine) of buffers for each of the cached buckets. The magazines
+    //! are only accessed by the thread that owns the cache, so they require no synchronization. The pool
+    //! refills and flushes the magazines in batches through the shared buckets.
+    template<class T>
+    class PoolThreadCache final
+    {
+        HeapArray<ArraySlice<T>> m_Buffers;
+        HeapArray<USize> m_Counts;
+        USize m_MagazineCapacity;
+
+    public:
+        inline PoolThreadCache(IAllocator* pAllocator, USize bucketCount, USize magazineCapacity)
+            : m_Buffers(pAllocator, bucketCount * magazineCapacity)
+            , m_Counts(pAllocator, bucketCount, 0)
+            , m_MagazineCapacity(magazineCapacity)
+        {
+        }
+
+        //! \brief Pop a buffer from the magazine of the specified bucket.
+        //!
+        //! \return True if the magazine wasn't empty.
+        UN_FINLINE bool TryPop(USize bucketIndex, ArraySlice<T>& buffer)
+        {
+            USize& count = m_Counts[bucketIndex];
+            if (count == 0)
+            {
+                return false;
+            }
+
+            buffer = m_Buffers[bucketIndex * m_MagazineCapacity + --count];
+            return true;
+        }
+
+        //! \brief Push a buffer to the magazine of the specified bucket.
+        //!
+        //! \return True if the magazine wasn't full.
+        UN_FINLINE bool TryPush(USize bucketIndex, const ArraySlice<T>& buffer)
+        {
+            USize& count = m_Counts[bucketIndex];
+            if (count == m_MagazineCapacity)
+            {
+                return false;
+            }
+
+            m_Buffers[bucketIndex * m_MagazineCapacity + count++] = buffer;
+            return true;
+        }
+
+        //! \brief Fill the magazine of the specified bucket with up to `count` buffers from the shared bucket.
+        //!
+        //! \return The number of buffers added to the magazine.
+        template<class TBucket>
+        inline USize Refill(USize bucketIndex, TBucket& bucket, USize count)
+        {
+            USize& current = m_Counts[bucketIndex];
+            auto begin     = bucketIndex * m_MagazineCapacity + current;
+            auto rented    = bucket.RentBatch(m_Buffers(begin, begin + std::min(count, m_MagazineCapacity - current)));
+            current += rented;
+            return rented;
+        }
+
+        //! \brief Move up to `count` buffers from the top of the magazine to the shared bucket.
+        template<class TBucket>
+        inline void Flush(USize bucketIndex, TBucket& bucket, USize count)
+        {
+            USize& current = m_Counts[bucketIndex];
+            count          = std::min(count, current);
+            current -= count;
+
+            auto begin = bucketIndex * m_MagazineCapacity + current;
+            bucket.ReturnBatch(m_Buffers(begin, begin + count));
+        }
+
+        //! \brief Get all buffers currently stored in the magazine of the specified bucket.
+        [[nodiscard]] inline ArraySlice<const ArraySlice<T>> GetBuffers(USize bucketIndex) const
+        {
+            auto begin = bucketIndex * m_MagazineCapacity;
+            return m_Buffers(begin, begin + m_Counts[bucketIndex]);
+        }
+    };
+} // namespace UN::Internal
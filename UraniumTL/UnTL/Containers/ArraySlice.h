@@ -1,5 +1,6 @@
 #pragma once
 #include <UnTL/Base/Base.h>
+#include <UnTL/Containers/Internal/SimdSearch.h>
 #include <UnTL/Containers/List.h>
 #include <array>
 #include <cstring>
@@ -27,6 +28,13 @@ namespace UN
         template<USize N>
         using StdArray = AddConst<std::array<std::remove_const_t<T>, N>>;
 
+        using ValueType = std::remove_const_t<T>;
+
+        //! \brief True if FindFirstOfAny and FindLastOfAny can use SIMD for the specified argument types.
+        template<class... TArgs>
+        inline static constexpr bool IsSimdSearchableAny = Internal::IsSimdSearchable<ValueType> && sizeof...(TArgs) > 0
+            && sizeof...(TArgs) <= Internal::SimdSearchMaxValues && (... && std::is_same_v<TArgs, ValueType>);
+
     public:
         inline ArraySlice() = default;
 
@@ -192,6 +200,11 @@ namespace UN
         //! \return The index of the value or -1.
         [[nodiscard]] inline SSize FindFirstOf(const T& value) const noexcept
         {
+            if constexpr (Internal::IsSimdSearchable<ValueType>)
+            {
+                return Internal::SimdFindFirstOf<ValueType>(m_pBegin, Length(), value);
+            }
+
             return FindFirstOfPredicate([&value](const auto& x) {
                 return x == value;
             });
@@ -204,6 +217,11 @@ namespace UN
         //! \return The index of the value or -1.
         [[nodiscard]] inline SSize FindLastOf(const T& value) const noexcept
         {
+            if constexpr (Internal::IsSimdSearchable<ValueType>)
+            {
+                return Internal::SimdFindLastOf<ValueType>(m_pBegin, Length(), value);
+            }
+
             return FindLastOfPredicate([&value](const auto& x) {
                 return x == value;
             });
@@ -217,6 +235,12 @@ namespace UN
         template<class... TArgs>
         [[nodiscard]] inline SSize FindFirstOfAny(const TArgs&... values) const noexcept
         {
+            if constexpr (IsSimdSearchableAny<TArgs...>)
+            {
+                const ValueType needles[] = { values... };
+                return Internal::SimdFindFirstOfAny(m_pBegin, Length(), needles);
+            }
+
             return FindFirstOfPredicate([&](const auto& x) {
                 return (... || (x == values));
             });
@@ -230,6 +254,12 @@ namespace UN
         template<class... TArgs>
         [[nodiscard]] inline SSize FindLastOfAny(const TArgs&... values) const noexcept
         {
+            if constexpr (IsSimdSearchableAny<TArgs...>)
+            {
+                const ValueType needles[] = { values... };
+                return Internal::SimdFindLastOfAny(m_pBegin, Length(), needles);
+            }
+
             return FindLastOfPredicate([&](const auto& x) {
                 return (... || (x == values));
             });
@@ -0,0 +1,494 @@
+#pragma once
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/RTTI/RTTI.h>
+#include <iterator>
+
+namespace UN
+{
+    namespace Internal
+    {
+        //! \brief Get the largest power of two number of elements that fit into 16 KB, at least one.
+        template<class T>
+        inline constexpr USize GetDefaultChunkLength() noexcept
+        {
+            USize result = 1;
+            while (result * 2 * sizeof(T) <= 16 * 1024)
+            {
+                result *= 2;
+            }
+
+            return result;
+        }
+    } // namespace Internal
+
+    //! \brief A list that stores the elements in fixed-size chunks, the elements are never moved.
+    //!
+    //! Unlike List, growing the container allocates a new chunk instead of reallocating the whole buffer,
+    //! so push is O(1) without copying and pointers and references to the elements stay valid until the
+    //! elements are removed. The container keeps a List of pointers to the chunks, which is the only part
+    //! that is reallocated on growth.
+    //!
+    //! Random access takes a shift and a mask, so it's slightly slower than with List. For bulk processing
+    //! iterate over the chunks: GetChunk() returns an ArraySlice of contiguous elements.
+    //!
+    //! The chunks are allocated from the IAllocator passed to the constructor or from SystemAllocator by default.
+    //! Clear() and removal of elements keep the chunks, call Shrink() to free them.
+    //!
+    //! \tparam T           - Type of the elements.
+    //! \tparam ChunkLength - The number of elements in a chunk, must be a power of two.
+    template<class T, USize ChunkLength = Internal::GetDefaultChunkLength<T>()>
+    class ChunkedList final
+    {
+        static_assert(ChunkLength > 0 && (ChunkLength & (ChunkLength - 1)) == 0, "Chunk length must be a power of two");
+
+        inline static constexpr USize Alignment = std::max(static_cast<USize>(16), alignof(T));
+        inline static constexpr USize ChunkMask = ChunkLength - 1;
+
+        List<T*> m_Chunks;
+        USize m_Size = 0;
+
+        inline static constexpr USize ChunkShift = [] {
+            USize result = 0;
+            while ((static_cast<USize>(1) << result) < ChunkLength)
+            {
+                ++result;
+            }
+
+            return result;
+        }();
+
+        inline void AllocateChunk()
+        {
+            void* pChunk = m_Chunks.GetAllocator()->Allocate(ChunkLength * sizeof(T), Alignment);
+            m_Chunks.Push(static_cast<T*>(pChunk));
+        }
+
+        inline void DeallocateChunks(USize firstChunk)
+        {
+            for (USize i = firstChunk; i < m_Chunks.Size(); ++i)
+            {
+                m_Chunks.GetAllocator()->Deallocate(m_Chunks[i], ChunkLength * sizeof(T), Alignment);
+            }
+
+            m_Chunks.Resize(firstChunk);
+        }
+
+        [[nodiscard]] inline T* GetSlot(USize index) const noexcept
+        {
+            return m_Chunks[index >> ChunkShift] + (index & ChunkMask);
+        }
+
+        template<class TList, class TValue>
+        class IteratorImpl final
+        {
+            TList* m_pList = nullptr;
+            USize m_Index  = 0;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = T;
+            using difference_type   = SSize;
+            using pointer           = TValue*;
+            using reference         = TValue&;
+
+            inline IteratorImpl() = default;
+
+            inline IteratorImpl(TList* pList, USize index) noexcept
+                : m_pList(pList)
+                , m_Index(index)
+            {
+            }
+
+            inline TValue& operator*() const noexcept
+            {
+                return (*m_pList)[m_Index];
+            }
+
+            inline TValue* operator->() const noexcept
+            {
+                return &(*m_pList)[m_Index];
+            }
+
+            inline TValue& operator[](SSize offset) const noexcept
+            {
+                return (*m_pList)[m_Index + offset];
+            }
+
+            inline IteratorImpl& operator++() noexcept
+            {
+                ++m_Index;
+                return *this;
+            }
+
+            inline IteratorImpl operator++(int) noexcept
+            {
+                IteratorImpl temp = *this;
+                ++m_Index;
+                return temp;
+            }
+
+            inline IteratorImpl& operator--() noexcept
+            {
+                --m_Index;
+                return *this;
+            }
+
+            inline IteratorImpl operator--(int) noexcept
+            {
+                IteratorImpl temp = *this;
+                --m_Index;
+                return temp;
+            }
+
+            inline IteratorImpl& operator+=(SSize offset) noexcept
+            {
+                m_Index += offset;
+                return *this;
+            }
+
+            inline IteratorImpl& operator-=(SSize offset) noexcept
+            {
+                m_Index -= offset;
+                return *this;
+            }
+
+            inline friend IteratorImpl operator+(IteratorImpl iterator, SSize offset) noexcept
+            {
+                return iterator += offset;
+            }
+
+            inline friend IteratorImpl operator+(SSize offset, IteratorImpl iterator) noexcept
+            {
+                return iterator += offset;
+            }
+
+            inline friend IteratorImpl operator-(IteratorImpl iterator, SSize offset) noexcept
+            {
+                return iterator -= offset;
+            }
+
+            inline friend SSize operator-(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return static_cast<SSize>(lhs.m_Index) - static_cast<SSize>(rhs.m_Index);
+            }
+
+            inline friend bool operator==(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return lhs.m_Index == rhs.m_Index;
+            }
+
+            inline friend bool operator!=(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return lhs.m_Index != rhs.m_Index;
+            }
+
+            inline friend bool operator<(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return lhs.m_Index < rhs.m_Index;
+            }
+
+            inline friend bool operator>(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return lhs.m_Index > rhs.m_Index;
+            }
+
+            inline friend bool operator<=(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return lhs.m_Index <= rhs.m_Index;
+            }
+
+            inline friend bool operator>=(const IteratorImpl& lhs, const IteratorImpl& rhs) noexcept
+            {
+                return lhs.m_Index >= rhs.m_Index;
+            }
+        };
+
+    public:
+        UN_RTTI_Struct(ChunkedList, "0CF46151-D9D0-4230-834A-0E321D107165");
+
+        using Iterator      = IteratorImpl<ChunkedList, T>;
+        using ConstIterator = IteratorImpl<const ChunkedList, const T>;
+
+        inline ChunkedList() = default;
+
+        //! \brief Create an empty list that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit ChunkedList(IAllocator* pAllocator) noexcept
+            : m_Chunks(pAllocator)
+        {
+        }
+
+        inline ChunkedList(std::initializer_list<T> list)
+        {
+            Reserve(list.size());
+            for (const T& value : list)
+            {
+                Push(value);
+            }
+        }
+
+        inline ChunkedList(const ChunkedList& other)
+            : m_Chunks(other.m_Chunks.GetAllocator())
+        {
+            Reserve(other.m_Size);
+            for (const T& value : other)
+            {
+                Push(value);
+            }
+        }
+
+        inline ChunkedList(ChunkedList&& other) noexcept
+            : m_Chunks(std::move(other.m_Chunks))
+            , m_Size(other.m_Size)
+        {
+            other.m_Size = 0;
+        }
+
+        inline ChunkedList& operator=(const ChunkedList& other)
+        {
+            if (this == &other)
+            {
+                return *this;
+            }
+
+            Clear();
+            Reserve(other.m_Size);
+            for (const T& value : other)
+            {
+                Push(value);
+            }
+
+            return *this;
+        }
+
+        inline ChunkedList& operator=(ChunkedList&& other) noexcept
+        {
+            Swap(other);
+            return *this;
+        }
+
+        inline ~ChunkedList()
+        {
+            Clear();
+            DeallocateChunks(0);
+        }
+
+        //! \brief Get the number of elements.
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            return m_Size;
+        }
+
+        //! \brief Get the number of elements the list can hold without allocating new chunks.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Chunks.Size() * ChunkLength;
+        }
+
+        //! \brief Check if the list is empty.
+        [[nodiscard]] inline bool Empty() const noexcept
+        {
+            return m_Size == 0;
+        }
+
+        //! \brief Check if the list has any elements.
+        [[nodiscard]] inline bool Any() const noexcept
+        {
+            return m_Size != 0;
+        }
+
+        //! \brief Get the allocator used by the list.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_Chunks.GetAllocator();
+        }
+
+        //! \brief Allocate the chunks for at least N elements.
+        inline void Reserve(USize n)
+        {
+            const USize chunkCount = (n + ChunkMask) >> ChunkShift;
+            m_Chunks.Reserve(chunkCount);
+            while (m_Chunks.Size() < chunkCount)
+            {
+                AllocateChunk();
+            }
+        }
+
+        //! \brief Free the chunks that don't contain any elements.
+        inline void Shrink()
+        {
+            DeallocateChunks((m_Size + ChunkMask) >> ChunkShift);
+            m_Chunks.Shrink();
+        }
+
+        //! \brief Destroy all the elements, doesn't free the chunks.
+        inline void Clear()
+        {
+            for (USize chunk = 0; chunk < ChunkCount(); ++chunk)
+            {
+                ArraySlice<T> elements = GetChunk(chunk);
+                std::destroy(elements.Data(), elements.Data() + elements.Length());
+            }
+
+            m_Size = 0;
+        }
+
+        //! \brief Swap two lists.
+        inline void Swap(ChunkedList& other) noexcept
+        {
+            m_Chunks.Swap(other.m_Chunks);
+            std::swap(m_Size, other.m_Size);
+        }
+
+        //! \brief Construct an element in place at the back of the list.
+        //!
+        //! The arguments can reference the elements of the list, they are never moved.
+        //!
+        //! \param args - The arguments to the element constructor.
+        //!
+        //! \return The reference to the new element.
+        template<class... Args>
+        inline T& Emplace(Args&&... args)
+        {
+            if (m_Size == Capacity())
+            {
+                AllocateChunk();
+            }
+
+            T* pSlot = new (GetSlot(m_Size)) T(std::forward<Args>(args)...);
+            ++m_Size;
+            return *pSlot;
+        }
+
+        //! \brief Append an element to the back of the list.
+        //!
+        //! \return The reference to the new element.
+        inline T& Push(const T& x)
+        {
+            return Emplace(x);
+        }
+
+        //! \brief Append an element to the back of the list.
+        //!
+        //! \return The reference to the new element.
+        inline T& Push(T&& x)
+        {
+            return Emplace(std::move(x));
+        }
+
+        //! \brief Destroy the last element.
+        inline void RemoveBack()
+        {
+            UN_Assert(m_Size > 0, "List was empty");
+            --m_Size;
+            std::destroy_at(GetSlot(m_Size));
+        }
+
+        //! \brief Remove the last element and return it.
+        inline T Pop()
+        {
+            T result = std::move(Back());
+            RemoveBack();
+            return result;
+        }
+
+        //! \brief Remove an element by index and replace it with the last element.
+        //!
+        //! Invalidates references to the removed and to the last element only.
+        //!
+        //! \param index - The index of the element to remove.
+        inline void SwapRemoveAt(USize index)
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            if (index != m_Size - 1)
+            {
+                (*this)[index] = std::move(Back());
+            }
+
+            RemoveBack();
+        }
+
+        //! \brief Get the number of chunks that contain elements.
+        [[nodiscard]] inline USize ChunkCount() const noexcept
+        {
+            return (m_Size + ChunkMask) >> ChunkShift;
+        }
+
+        //! \brief Get the elements of a chunk, all chunks except the last one are full.
+        //!
+        //! \param index - The index of the chunk, must be less than ChunkCount().
+        [[nodiscard]] inline ArraySlice<T> GetChunk(USize index) noexcept
+        {
+            UN_Assert(index < ChunkCount(), "Invalid chunk index");
+            return ArraySlice<T>(m_Chunks[index], std::min(ChunkLength, m_Size - (index << ChunkShift)));
+        }
+
+        //! \brief Get the elements of a chunk, all chunks except the last one are full.
+        //!
+        //! \param index - The index of the chunk, must be less than ChunkCount().
+        [[nodiscard]] inline ArraySlice<const T> GetChunk(USize index) const noexcept
+        {
+            UN_Assert(index < ChunkCount(), "Invalid chunk index");
+            return ArraySlice<const T>(m_Chunks[index], std::min(ChunkLength, m_Size - (index << ChunkShift)));
+        }
+
+        [[nodiscard]] inline T& operator[](USize index) noexcept
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            return *GetSlot(index);
+        }
+
+        [[nodiscard]] inline const T& operator[](USize index) const noexcept
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            return *GetSlot(index);
+        }
+
+        [[nodiscard]] inline T& Front() noexcept
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] inline const T& Front() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] inline T& Back() noexcept
+        {
+            return (*this)[m_Size - 1];
+        }
+
+        [[nodiscard]] inline const T& Back() const noexcept
+        {
+            return (*this)[m_Size - 1];
+        }
+
+        [[nodiscard]] inline Iterator begin() noexcept
+        {
+            return Iterator(this, 0);
+        }
+
+        [[nodiscard]] inline Iterator end() noexcept
+        {
+            return Iterator(this, m_Size);
+        }
+
+        [[nodiscard]] inline ConstIterator begin() const noexcept
+        {
+            return ConstIterator(this, 0);
+        }
+
+        [[nodiscard]] inline ConstIterator end() const noexcept
+        {
+            return ConstIterator(this, m_Size);
+        }
+    };
+
+    template<class T, USize ChunkLength>
+    struct IsTriviallyRelocatable<ChunkedList<T, ChunkLength>> : std::true_type
+    {
+    };
+} // namespace UN
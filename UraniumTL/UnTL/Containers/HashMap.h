@@ -0,0 +1,286 @@
+#pragma once
+#include <UnTL/Containers/Internal/HashTable.h>
+#include <UnTL/RTTI/RTTI.h>
+#include <tuple>
+
+namespace UN
+{
+    namespace Internal
+    {
+        template<class TKey, class TValue>
+        struct HashMapPolicy
+        {
+            using KeyType  = TKey;
+            using SlotType = std::pair<const TKey, TValue>;
+
+            inline static constexpr bool IsTriviallyRelocatable =
+                ::UN::IsTriviallyRelocatable<TKey>::value && ::UN::IsTriviallyRelocatable<TValue>::value;
+
+            UN_FINLINE static const TKey& GetKey(const SlotType& slot) noexcept
+            {
+                return slot.first;
+            }
+        };
+    } // namespace Internal
+
+    //! \brief A hash map that stores the key-value pairs in a flat open addressing table.
+    //!
+    //! Unlike UnorderedMap, this container doesn't allocate a node per element: all the pairs are stored
+    //! in a single array, which is probed 16 slots at a time using SIMD (see Internal::HashTable).
+    //! Memory is allocated from the IAllocator passed to the constructor or from SystemAllocator by default.
+    //!
+    //! If both the hasher and the key comparer define `is_transparent`, the keys can be looked up by any type
+    //! that they accept. For example, `HashMap<String, T>` can be searched with a StringSlice without creating
+    //! a temporary String.
+    //!
+    //! \note Inserting an element may rehash the table and invalidate all the iterators and references.
+    //!
+    //! \tparam TKey      - Type of the keys.
+    //! \tparam TValue    - Type of the values.
+    //! \tparam THasher   - Type of the hash function object.
+    //! \tparam TKeyEqual - Type of the key comparison function object.
+    template<class TKey, class TValue, class THasher = std::hash<TKey>, class TKeyEqual = std::equal_to<>>
+    class HashMap final
+    {
+        using Table    = Internal::HashTable<Internal::HashMapPolicy<TKey, TValue>, THasher, TKeyEqual>;
+        using SlotType = typename Table::SlotType;
+
+        Table m_Table;
+
+    public:
+        UN_RTTI_Struct(HashMap, "329B6560-73E8-46F8-B219-86F9AFC012C8");
+
+        using Iterator      = Internal::HashTableIterator<SlotType>;
+        using ConstIterator = Internal::HashTableIterator<const SlotType>;
+
+        inline HashMap() = default;
+
+        //! \brief Create an empty map that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit HashMap(IAllocator* pAllocator) noexcept
+            : m_Table(pAllocator)
+        {
+        }
+
+        inline HashMap(std::initializer_list<SlotType> list)
+        {
+            m_Table.Reserve(list.size());
+            for (const auto& [key, value] : list)
+            {
+                TryEmplace(key, value);
+            }
+        }
+
+        //! \brief Get the number of elements in the map.
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            return m_Table.Size();
+        }
+
+        //! \brief Get the number of slots in the map.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Table.Capacity();
+        }
+
+        //! \brief Check if the map is empty.
+        [[nodiscard]] inline bool Empty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        //! \brief Check if the map has any elements.
+        [[nodiscard]] inline bool Any() const noexcept
+        {
+            return Size() != 0;
+        }
+
+        //! \brief Get the allocator used by the map.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_Table.GetAllocator();
+        }
+
+        //! \brief Make sure the map can hold N elements without rehashing.
+        //!
+        //! \param n - The number of elements to reserve the space for.
+        inline void Reserve(USize n)
+        {
+            m_Table.Reserve(n);
+        }
+
+        //! \brief Remove all the elements, doesn't free the memory.
+        inline void Clear()
+        {
+            m_Table.Clear();
+        }
+
+        //! \brief Swap two maps.
+        inline void Swap(HashMap& other) noexcept
+        {
+            m_Table.Swap(other.m_Table);
+        }
+
+        //! \brief Find an element by key.
+        //!
+        //! \param key - The key to find.
+        //!
+        //! \return An iterator to the found element or end().
+        template<class TLookup>
+        [[nodiscard]] inline Iterator Find(const TLookup& key) noexcept
+        {
+            return m_Table.MakeIterator(m_Table.Find(key));
+        }
+
+        //! \brief Find an element by key.
+        //!
+        //! \param key - The key to find.
+        //!
+        //! \return An iterator to the found element or end().
+        template<class TLookup>
+        [[nodiscard]] inline ConstIterator Find(const TLookup& key) const noexcept
+        {
+            return m_Table.MakeIterator(static_cast<const SlotType*>(m_Table.Find(key)));
+        }
+
+        //! \brief Find a value by key.
+        //!
+        //! \param key - The key to find.
+        //!
+        //! \return A pointer to the found value or nullptr.
+        template<class TLookup>
+        [[nodiscard]] inline TValue* TryGet(const TLookup& key) noexcept
+        {
+            SlotType* pSlot = m_Table.Find(key);
+            return pSlot ? &pSlot->second : nullptr;
+        }
+
+        //! \brief Find a value by key.
+        //!
+        //! \param key - The key to find.
+        //!
+        //! \return A pointer to the found value or nullptr.
+        template<class TLookup>
+        [[nodiscard]] inline const TValue* TryGet(const TLookup& key) const noexcept
+        {
+            const SlotType* pSlot = m_Table.Find(key);
+            return pSlot ? &pSlot->second : nullptr;
+        }
+
+        //! \brief Check if the map contains the specified key.
+        template<class TLookup>
+        [[nodiscard]] inline bool Contains(const TLookup& key) const noexcept
+        {
+            return m_Table.Find(key) != nullptr;
+        }
+
+        //! \brief Insert a new element constructed from the arguments if the key is not present in the map.
+        //!
+        //! The arguments are not used if the key was found.
+        //!
+        //! \param key  - The key of the element.
+        //! \param args - The arguments to construct the value with.
+        //!
+        //! \return An iterator to the element with the key and true if the element was inserted.
+        template<class TLookup, class... Args>
+        inline std::pair<Iterator, bool> TryEmplace(TLookup&& key, Args&&... args)
+        {
+            if constexpr (Table::template IsLookupType<std::decay_t<TLookup>>)
+            {
+                auto [pSlot, found] = m_Table.FindOrPrepareInsert(key);
+                if (!found)
+                {
+                    new (pSlot) SlotType(std::piecewise_construct,
+                                         std::forward_as_tuple(std::forward<TLookup>(key)),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+                }
+
+                return { m_Table.MakeIterator(pSlot), !found };
+            }
+            else
+            {
+                return TryEmplace(TKey(std::forward<TLookup>(key)), std::forward<Args>(args)...);
+            }
+        }
+
+        //! \brief Insert a new element or assign the value if the key is already present in the map.
+        //!
+        //! \param key   - The key of the element.
+        //! \param value - The value to insert or assign.
+        //!
+        //! \return An iterator to the element and true if the element was inserted.
+        template<class TLookup, class TValueArg>
+        inline std::pair<Iterator, bool> InsertOrAssign(TLookup&& key, TValueArg&& value)
+        {
+            auto result = TryEmplace(std::forward<TLookup>(key), std::forward<TValueArg>(value));
+            if (!result.second)
+            {
+                result.first->second = std::forward<TValueArg>(value);
+            }
+
+            return result;
+        }
+
+        //! \brief Get the value by key, insert a default constructed value if the key is not present in the map.
+        template<class TLookup>
+        inline TValue& operator[](TLookup&& key)
+        {
+            return TryEmplace(std::forward<TLookup>(key)).first->second;
+        }
+
+        //! \brief Remove an element by key.
+        //!
+        //! \param key - The key of the element to remove.
+        //!
+        //! \return True if the element was found and removed.
+        template<class TLookup>
+        inline bool Remove(const TLookup& key)
+        {
+            SlotType* pSlot = m_Table.Find(key);
+            if (pSlot == nullptr)
+            {
+                return false;
+            }
+
+            m_Table.Erase(pSlot);
+            return true;
+        }
+
+        //! \brief Remove an element by iterator.
+        //!
+        //! \param iterator - A valid iterator to the element to remove.
+        inline void Remove(ConstIterator iterator)
+        {
+            m_Table.Erase(const_cast<SlotType*>(iterator.operator->()));
+        }
+
+        //! \brief Remove an element by iterator.
+        //!
+        //! \param iterator - A valid iterator to the element to remove.
+        inline void Remove(Iterator iterator)
+        {
+            m_Table.Erase(iterator.operator->());
+        }
+
+        [[nodiscard]] inline Iterator begin() noexcept
+        {
+            return m_Table.template Begin<SlotType>();
+        }
+
+        [[nodiscard]] inline ConstIterator begin() const noexcept
+        {
+            return m_Table.template Begin<const SlotType>();
+        }
+
+        [[nodiscard]] inline Iterator end() noexcept
+        {
+            return m_Table.template End<SlotType>();
+        }
+
+        [[nodiscard]] inline ConstIterator end() const noexcept
+        {
+            return m_Table.template End<const SlotType>();
+        }
+    };
+} // namespace UN
@@ -0,0 +1,182 @@
+#pragma once
+#include <UnTL/Containers/Internal/HashTable.h>
+#include <UnTL/RTTI/RTTI.h>
+
+namespace UN
+{
+    namespace Internal
+    {
+        template<class TKey>
+        struct HashSetPolicy
+        {
+            using KeyType  = TKey;
+            using SlotType = TKey;
+
+            inline static constexpr bool IsTriviallyRelocatable = ::UN::IsTriviallyRelocatable<TKey>::value;
+
+            UN_FINLINE static const TKey& GetKey(const SlotType& slot) noexcept
+            {
+                return slot;
+            }
+        };
+    } // namespace Internal
+
+    //! \brief A hash set that stores the keys in a flat open addressing table.
+    //!
+    //! See HashMap for details, the same rules apply to lookup and iterator invalidation.
+    //!
+    //! \tparam TKey      - Type of the keys.
+    //! \tparam THasher   - Type of the hash function object.
+    //! \tparam TKeyEqual - Type of the key comparison function object.
+    template<class TKey, class THasher = std::hash<TKey>, class TKeyEqual = std::equal_to<>>
+    class HashSet final
+    {
+        using Table = Internal::HashTable<Internal::HashSetPolicy<TKey>, THasher, TKeyEqual>;
+
+        Table m_Table;
+
+    public:
+        UN_RTTI_Struct(HashSet, "59F909B6-23D7-42E2-A243-04E7F4A5B4B7");
+
+        using Iterator = Internal::HashTableIterator<const TKey>;
+
+        inline HashSet() = default;
+
+        //! \brief Create an empty set that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit HashSet(IAllocator* pAllocator) noexcept
+            : m_Table(pAllocator)
+        {
+        }
+
+        inline HashSet(std::initializer_list<TKey> list)
+        {
+            m_Table.Reserve(list.size());
+            for (const auto& key : list)
+            {
+                Insert(key);
+            }
+        }
+
+        //! \brief Get the number of elements in the set.
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            return m_Table.Size();
+        }
+
+        //! \brief Get the number of slots in the set.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Table.Capacity();
+        }
+
+        //! \brief Check if the set is empty.
+        [[nodiscard]] inline bool Empty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        //! \brief Check if the set has any elements.
+        [[nodiscard]] inline bool Any() const noexcept
+        {
+            return Size() != 0;
+        }
+
+        //! \brief Get the allocator used by the set.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_Table.GetAllocator();
+        }
+
+        //! \brief Make sure the set can hold N elements without rehashing.
+        //!
+        //! \param n - The number of elements to reserve the space for.
+        inline void Reserve(USize n)
+        {
+            m_Table.Reserve(n);
+        }
+
+        //! \brief Remove all the elements, doesn't free the memory.
+        inline void Clear()
+        {
+            m_Table.Clear();
+        }
+
+        //! \brief Swap two sets.
+        inline void Swap(HashSet& other) noexcept
+        {
+            m_Table.Swap(other.m_Table);
+        }
+
+        //! \brief Find a key.
+        //!
+        //! \param key - The key to find.
+        //!
+        //! \return An iterator to the found key or end().
+        template<class TLookup>
+        [[nodiscard]] inline Iterator Find(const TLookup& key) const noexcept
+        {
+            return m_Table.MakeIterator(static_cast<const TKey*>(m_Table.Find(key)));
+        }
+
+        //! \brief Check if the set contains the specified key.
+        template<class TLookup>
+        [[nodiscard]] inline bool Contains(const TLookup& key) const noexcept
+        {
+            return m_Table.Find(key) != nullptr;
+        }
+
+        //! \brief Insert a key if it's not present in the set.
+        //!
+        //! \param key - The key to insert.
+        //!
+        //! \return True if the key was inserted.
+        template<class TLookup>
+        inline bool Insert(TLookup&& key)
+        {
+            if constexpr (Table::template IsLookupType<std::decay_t<TLookup>>)
+            {
+                auto [pSlot, found] = m_Table.FindOrPrepareInsert(key);
+                if (!found)
+                {
+                    new (pSlot) TKey(std::forward<TLookup>(key));
+                }
+
+                return !found;
+            }
+            else
+            {
+                return Insert(TKey(std::forward<TLookup>(key)));
+            }
+        }
+
+        //! \brief Remove a key.
+        //!
+        //! \param key - The key to remove.
+        //!
+        //! \return True if the key was found and removed.
+        template<class TLookup>
+        inline bool Remove(const TLookup& key)
+        {
+            TKey* pSlot = m_Table.Find(key);
+            if (pSlot == nullptr)
+            {
+                return false;
+            }
+
+            m_Table.Erase(pSlot);
+            return true;
+        }
+
+        [[nodiscard]] inline Iterator begin() const noexcept
+        {
+            return m_Table.template Begin<const TKey>();
+        }
+
+        [[nodiscard]] inline Iterator end() const noexcept
+        {
+            return m_Table.template End<const TKey>();
+        }
+    };
+} // namespace UN
@@ -40,7 +40,7 @@ namespace UN
                 return;
             }
 
-            m_pAllocator->Deallocate(storage.Data());
+            m_pAllocator->Deallocate(storage.Data(), storage.Length() * sizeof(T), Alignment);
         }
 
         inline void DeallocateStorage()
@@ -299,4 +299,9 @@ namespace UN
             return m_Storage;
         }
     };
+
+    template<class T>
+    struct IsTriviallyRelocatable<HeapArray<T>> : std::true_type
+    {
+    };
 } // namespace UN
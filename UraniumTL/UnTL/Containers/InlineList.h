@@ -0,0 +1,762 @@
+#pragma once
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Containers/Internal/SimdSearch.h>
+#include <UnTL/Memory/Memory.h>
+#include <algorithm>
+
+namespace UN
+{
+    //! \brief A List that stores the first N elements inline and only allocates when it grows past them.
+    //!
+    //! Has the same interface as List<T>, so that a call site that typically stores only a few elements
+    //! can switch to it and save an allocation per list:
+    //! \code{.cpp}
+    //!     auto parts = str.Split<InlineList<StringSlice, 8>>(',');
+    //! \endcode
+    //!
+    //! Moving an InlineList is O(N) when the elements are stored inline, since they must be moved one by one.
+    //! Heap allocations are aligned to 16 bytes, just like in List<T>.
+    //!
+    //! Once the list spills out of the inline storage, the memory is allocated from the IAllocator passed
+    //! to the constructor, or from SystemAllocator if none was specified. The allocator must outlive the list.
+    //! Same as in List<T>, moves and copy construction take the allocator of the source list, copy assignment
+    //! keeps the allocator of the destination.
+    //!
+    //! \tparam T - Type of the elements.
+    //! \tparam N - Number of elements to store inline.
+    template<class T, USize N>
+    class InlineList final
+    {
+        static_assert(N > 0, "Use List<T> if inline storage is not needed");
+
+        inline static constexpr USize Alignment = std::max(static_cast<USize>(16), alignof(T));
+
+        T* m_Begin;
+        T* m_End;
+        T* m_EndCap;
+        IAllocator* m_pAllocator = SystemAllocator::Get();
+        alignas(T) UInt8 m_Storage[N * sizeof(T)];
+
+        [[nodiscard]] UN_FINLINE T* GetInlineStorage() noexcept
+        {
+            return reinterpret_cast<T*>(m_Storage);
+        }
+
+        inline T* Allocate(USize n) noexcept
+        {
+            return static_cast<T*>(m_pAllocator->Allocate(n * sizeof(T), Alignment));
+        }
+
+        inline void Deallocate(T* pointer, USize n) noexcept
+        {
+            m_pAllocator->Deallocate(pointer, n * sizeof(T), Alignment);
+        }
+
+        inline void ResetToInline() noexcept
+        {
+            m_Begin  = GetInlineStorage();
+            m_End    = m_Begin;
+            m_EndCap = m_Begin + N;
+        }
+
+        inline void VDeallocate() noexcept
+        {
+            if (!IsInline())
+            {
+                Deallocate(m_Begin, Capacity());
+            }
+
+            ResetToInline();
+        }
+
+        inline void ConstructAtEnd(USize n)
+        {
+            for (USize i = 0; i < n; ++i)
+            {
+                new (m_End++) T();
+            }
+        }
+
+        inline void ConstructAtEnd(USize n, const T& x)
+        {
+            for (USize i = 0; i < n; ++i)
+            {
+                new (m_End++) T(x);
+            }
+        }
+
+        inline void DestructAtEnd(T* newEnd)
+        {
+            T* ptr = m_End;
+            while (newEnd != ptr)
+            {
+                (--ptr)->~T();
+            }
+            m_End = newEnd;
+        }
+
+        inline static void RelocateData(T* dest, T* src, USize count) noexcept
+        {
+            if constexpr (IsTriviallyRelocatable<T>::value)
+            {
+                memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(T));
+            }
+            else
+            {
+                for (USize i = 0; i < count; ++i)
+                {
+                    new (dest + i) T(std::move(src[i]));
+                    src[i].~T();
+                }
+            }
+        }
+
+        inline void Grow(USize newCap)
+        {
+            auto size = Size();
+            if (!IsInline() && IsTriviallyRelocatable<T>::value)
+            {
+                auto* pData = m_pAllocator->Reallocate(m_Begin, Capacity() * sizeof(T), newCap * sizeof(T), Alignment);
+                m_Begin     = static_cast<T*>(pData);
+            }
+            else
+            {
+                T* newBegin = Allocate(newCap);
+                RelocateData(newBegin, m_Begin, size);
+                if (!IsInline())
+                {
+                    Deallocate(m_Begin, Capacity());
+                }
+
+                m_Begin = newBegin;
+            }
+
+            m_End    = m_Begin + size;
+            m_EndCap = m_Begin + newCap;
+        }
+
+        inline void AppendImpl(USize n)
+        {
+            if (m_EndCap - m_End >= static_cast<SSize>(n))
+            {
+                return;
+            }
+
+            Grow(std::max(2 * Capacity(), Size() + n));
+        }
+
+        inline void MoveFrom(InlineList& other) noexcept
+        {
+            m_pAllocator = other.m_pAllocator;
+            if (other.IsInline())
+            {
+                RelocateData(m_Begin, other.m_Begin, other.Size());
+                m_End = m_Begin + other.Size();
+            }
+            else
+            {
+                m_Begin  = other.m_Begin;
+                m_End    = other.m_End;
+                m_EndCap = other.m_EndCap;
+            }
+
+            other.ResetToInline();
+        }
+
+    public:
+        UN_RTTI_Struct(InlineList, "1F943060-1740-4686-8975-09E0A985790C");
+
+        inline InlineList() noexcept
+        {
+            ResetToInline();
+        }
+
+        inline InlineList(InlineList&& other) noexcept
+        {
+            ResetToInline();
+            MoveFrom(other);
+        }
+
+        inline InlineList(const InlineList& other)
+            : m_pAllocator(other.m_pAllocator)
+        {
+            ResetToInline();
+            Append(other.Size(), other.Data());
+        }
+
+        inline InlineList& operator=(InlineList&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Clear();
+                VDeallocate();
+                MoveFrom(other);
+            }
+
+            return *this;
+        }
+
+        inline InlineList& operator=(const InlineList& other)
+        {
+            if (this != &other)
+            {
+                Clear();
+                Append(other.Size(), other.Data());
+            }
+
+            return *this;
+        }
+
+        //! \brief Create an empty list that uses the specified allocator when it spills to the heap.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit InlineList(IAllocator* pAllocator) noexcept
+            : m_pAllocator(pAllocator)
+        {
+            ResetToInline();
+        }
+
+        inline InlineList(USize n, const T& x)
+        {
+            ResetToInline();
+            Append(n, x);
+        }
+
+        //! \brief Create a list of N copies of X that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        //! \param n          - The number of elements.
+        //! \param x          - The element to copy N times.
+        inline InlineList(IAllocator* pAllocator, USize n, const T& x)
+            : m_pAllocator(pAllocator)
+        {
+            ResetToInline();
+            Append(n, x);
+        }
+
+        inline InlineList(std::initializer_list<T> list)
+        {
+            ResetToInline();
+            Append(list.size(), list.begin());
+        }
+
+        inline InlineList& operator=(std::initializer_list<T> list)
+        {
+            Clear();
+            Append(list.size(), list.begin());
+            return *this;
+        }
+
+        inline ~InlineList()
+        {
+            Clear();
+            VDeallocate();
+        }
+
+        //! \brief Check if the elements are stored in the inline storage, i.e. the list hasn't allocated any memory.
+        [[nodiscard]] inline bool IsInline() const noexcept
+        {
+            return m_Begin == reinterpret_cast<const T*>(m_Storage);
+        }
+
+        //! \brief Push a new element to the back of the container and move.
+        //!
+        //! \param x - The element to push.
+        //!
+        //! \return The reference to the back of the container.
+        inline T& Push(T&& x)
+        {
+            return Emplace(std::move(x));
+        }
+
+        //! \brief Push a new element to the back of the container and copy.
+        //!
+        //! \param x - The element to push.
+        //!
+        //! \return The reference to the back of the container.
+        inline T& Push(const T& x)
+        {
+            return Emplace(x);
+        }
+
+        //! \brief Construct an element in place at back of the container.
+        //!
+        //! \tparam Args - Types of the arguments.
+        //! \param args - The arguments to the element constructor with.
+        //!
+        //! \return The reference to the back of the container.
+        template<class... Args>
+        inline T& Emplace(Args&&... args)
+        {
+            if (m_End == m_EndCap)
+            {
+                // The arguments can reference an element of this list, construct before moving the elements.
+                T value(std::forward<Args>(args)...);
+                AppendImpl(1);
+                return *new (m_End++) T(std::move(value));
+            }
+
+            return *new (m_End++) T(std::forward<Args>(args)...);
+        }
+
+        //! \brief Destruct the back of the container.
+        inline void RemoveBack()
+        {
+            UN_Assert(!Empty(), "List was empty");
+            DestructAtEnd(m_End - 1);
+        }
+
+        //! \brief Pop an element from the back.
+        inline T Pop()
+        {
+            auto res = std::move(Back());
+            RemoveBack();
+            return res;
+        }
+
+        //! \brief Append a new element to the back of the container and move.
+        //!
+        //! \param x - The element to push.
+        //!
+        //! \return The reference to the container.
+        inline InlineList& Append(T&& x)
+        {
+            Push(std::move(x));
+            return *this;
+        }
+
+        //! \brief Append a new element to the back of the container and copy.
+        //!
+        //! \param x - The element to push.
+        //!
+        //! \return The reference to the container.
+        inline InlineList& Append(const T& x)
+        {
+            Push(x);
+            return *this;
+        }
+
+        //! \brief Append N default constructed elements to the back of the container.
+        //!
+        //! \param n - The number of elements to append.
+        //!
+        //! \return The reference to the container.
+        inline InlineList& Append(USize n)
+        {
+            AppendImpl(n);
+            ConstructAtEnd(n);
+            return *this;
+        }
+
+        //! \brief Append N copies of the specified element to the back of the container.
+        //!
+        //! \param n - The number of elements to append.
+        //! \param x - The element to copy N times.
+        //!
+        //! \return The reference to the container.
+        inline InlineList& Append(USize n, const T& x)
+        {
+            AppendImpl(n);
+            ConstructAtEnd(n, x);
+            return *this;
+        }
+
+        //! \brief Append a C-style array to the back of the container.
+        //!
+        //! \param n    - The number of elements to append.
+        //! \param data - The data to be appended.
+        //!
+        //! \return The reference to the container.
+        inline InlineList& Append(USize n, const T* data)
+        {
+            AppendImpl(n);
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                memcpy(m_End, data, n * sizeof(T));
+                m_End += n;
+            }
+            else
+            {
+                for (USize i = 0; i < n; ++i)
+                {
+                    new (m_End++) T(data[i]);
+                }
+            }
+
+            return *this;
+        }
+
+        //! \brief Get the length of the container in number of elements.
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            return m_End - m_Begin;
+        }
+
+        //! \brief Get the capacity of the container. Always greater than or equal to N.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_EndCap - m_Begin;
+        }
+
+        //! \brief Check if the container is empty.
+        [[nodiscard]] inline bool Empty() const noexcept
+        {
+            return m_End == m_Begin;
+        }
+
+        //! \brief Check if the container has any elements.
+        [[nodiscard]] inline bool Any() const noexcept
+        {
+            return !Empty();
+        }
+
+        //! \brief Reserve capacity for N elements. Does nothing if Capacity() >= N.
+        //!
+        //! \param n - The capacity to reserve.
+        inline void Reserve(USize n)
+        {
+            if (Capacity() >= n)
+            {
+                return;
+            }
+
+            Grow(n);
+        }
+
+        //! \brief Resize the container.
+        //!
+        //! If Size() < n, will construct new elements on the back to fit size.
+        //! If Size() > n, Will destruct to fit size.
+        //!
+        //! \param n - The new size of the container.
+        inline void Resize(USize n)
+        {
+            Resize(n, T{});
+        }
+
+        //! \brief Resize the container.
+        //!
+        //! If Size() < n, will construct new elements on the back to fit size.
+        //! If Size() > n, Will destruct to fit size.
+        //!
+        //! \param n - The new size of the container.
+        //! \param x - The element to copy to the new elements (if any were added).
+        inline void Resize(USize n, const T& x)
+        {
+            auto size = Size();
+            if (size > n)
+            {
+                DestructAtEnd(m_Begin + n);
+                return;
+            }
+
+            Reserve(n);
+            ConstructAtEnd(n - size, x);
+        }
+
+        //! \brief Find a value if the container and return its index or -1.
+        //!
+        //! \param value - The value to find.
+        inline SSize IndexOf(const T& value) const
+        {
+            if constexpr (Internal::IsSimdSearchable<T>)
+            {
+                return Internal::SimdFindFirstOf<T>(m_Begin, Size(), value);
+            }
+
+            auto size = static_cast<SSize>(Size());
+            for (SSize i = 0; i < size; ++i)
+            {
+                if (m_Begin[i] == value)
+                {
+                    return i;
+                }
+            }
+
+            return -1;
+        }
+
+        //! \brief Check if a value is present in the list.
+        //!
+        //! \param value - The value to check for.
+        inline bool Contains(const T& value) const
+        {
+            return IndexOf(value) != -1;
+        }
+
+        //! \brief Insert a new element at index, will move all right values by one to the right.
+        //!
+        //! \param index - The index to insert at, must be less than or equal to Size().
+        //! \param args  - The arguments to the element constructor with.
+        //!
+        //! \return The reference to the inserted element.
+        template<class... Args>
+        inline T& EmplaceAt(USize index, Args&&... args)
+        {
+            UN_Assert(index <= Size(), "Invalid index");
+            if (index == Size())
+            {
+                return Emplace(std::forward<Args>(args)...);
+            }
+
+            // The arguments can reference an element of this list, construct before moving the elements.
+            T value(std::forward<Args>(args)...);
+            AppendImpl(1);
+
+            T* pos = m_Begin + index;
+            if constexpr (IsTriviallyRelocatable<T>::value)
+            {
+                memmove(static_cast<void*>(pos + 1), static_cast<const void*>(pos), (m_End - pos) * sizeof(T));
+                new (pos) T(std::move(value));
+            }
+            else
+            {
+                new (m_End) T(std::move(*(m_End - 1)));
+                std::move_backward(pos, m_End - 1, m_End);
+                *pos = std::move(value);
+            }
+
+            ++m_End;
+            return *pos;
+        }
+
+        //! \brief Insert a new element at index and move, will move all right values by one to the right.
+        //!
+        //! \param index - The index to insert at, must be less than or equal to Size().
+        //! \param x     - The element to insert.
+        //!
+        //! \return The reference to the inserted element.
+        inline T& Insert(USize index, T&& x)
+        {
+            return EmplaceAt(index, std::move(x));
+        }
+
+        //! \brief Insert a new element at index and copy, will move all right values by one to the right.
+        //!
+        //! \param index - The index to insert at, must be less than or equal to Size().
+        //! \param x     - The element to insert.
+        //!
+        //! \return The reference to the inserted element.
+        inline T& Insert(USize index, const T& x)
+        {
+            return EmplaceAt(index, x);
+        }
+
+        //! \brief Remove value at index, will move all right values by one to the left.
+        inline void RemoveAt(USize index)
+        {
+            UN_Assert(index < Size(), "Invalid index");
+            if constexpr (IsTriviallyRelocatable<T>::value)
+            {
+                T* pos = m_Begin + index;
+                pos->~T();
+                memmove(static_cast<void*>(pos), static_cast<const void*>(pos + 1), (m_End - pos - 1) * sizeof(T));
+                --m_End;
+            }
+            else
+            {
+                std::move(m_Begin + index + 1, m_End, m_Begin + index);
+                DestructAtEnd(m_End - 1);
+            }
+        }
+
+        //! \brief Remove value at index, will swap the last value with the removed value.
+        inline void SwapRemoveAt(USize index)
+        {
+            UN_Assert(index < Size(), "Invalid index");
+            if (index < Size() - 1)
+            {
+                std::swap(m_Begin[index], m_Begin[Size() - 1]);
+            }
+
+            DestructAtEnd(m_End - 1);
+        }
+
+        //! \brief Remove the value, will move all right values by one to the left.
+        inline bool Remove(const T& value)
+        {
+            auto index = IndexOf(value);
+            if (index == -1)
+            {
+                return false;
+            }
+
+            RemoveAt(static_cast<USize>(index));
+            return true;
+        }
+
+        //! \brief Remove the value, will swap the last value with the removed value.
+        inline bool SwapRemove(const T& value)
+        {
+            auto index = IndexOf(value);
+            if (index == -1)
+            {
+                return false;
+            }
+
+            SwapRemoveAt(static_cast<USize>(index));
+            return true;
+        }
+
+        //! \brief Swap two lists.
+        inline void Swap(InlineList& other)
+        {
+            InlineList temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        //! \brief Get the allocator used by the list when it spills out of the inline storage.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_pAllocator;
+        }
+
+        //! \brief Sort elements in the container using a member of T as sorting key.
+        //!
+        //! \tparam TMember - Type of pointer to member (must implement relational operators).
+        //!
+        //! \param member     - Pointer to member to use as sorting key.
+        //! \param descending - True if the List must be sorted in descending order.
+        template<class TMember>
+        inline void SortByMember(TMember member,
+                                 std::enable_if_t<std::is_member_object_pointer_v<TMember>, bool> descending = false)
+        {
+            if (descending)
+            {
+                Sort([member](const T& lhs, const T& rhs) {
+                    return lhs.*member > rhs.*member;
+                });
+            }
+            else
+            {
+                Sort([member](const T& lhs, const T& rhs) {
+                    return lhs.*member < rhs.*member;
+                });
+            }
+        }
+
+        template<class TMember>
+        inline void SortByMember(TMember member,
+                                 std::enable_if_t<std::is_member_function_pointer_v<TMember>, bool> descending = false)
+        {
+            if (descending)
+            {
+                Sort([member](const T& lhs, const T& rhs) {
+                    return std::invoke(member, lhs) > std::invoke(member, rhs);
+                });
+            }
+            else
+            {
+                Sort([member](const T& lhs, const T& rhs) {
+                    return std::invoke(member, lhs) < std::invoke(member, rhs);
+                });
+            }
+        }
+
+        //! \brief Sort elements in the container by predicate.
+        //!
+        //! \tparam F - Type of the predicate.
+        //!
+        //! \param f - A functor to use as the sorting predicate.
+        template<class F>
+        inline void Sort(F&& f)
+        {
+            std::sort(m_Begin, m_End, std::forward<F>(f));
+        }
+
+        //! \brief Sort elements in the container.
+        inline void Sort()
+        {
+            std::sort(m_Begin, m_End);
+        }
+
+        [[nodiscard]] inline T& operator[](USize index) noexcept
+        {
+            UN_Assert(index < Size(), "Invalid index");
+            return m_Begin[index];
+        }
+
+        [[nodiscard]] inline const T& operator[](USize index) const noexcept
+        {
+            UN_Assert(index < Size(), "Invalid index");
+            return m_Begin[index];
+        }
+
+        //! \brief Clear the container. Doesn't free the heap memory if the list has spilled out of the inline storage.
+        inline void Clear()
+        {
+            DestructAtEnd(m_Begin);
+        }
+
+        //! \brief Get the first element of the container.
+        [[nodiscard]] inline T& Front() noexcept
+        {
+            UN_Assert(!Empty(), "List was empty");
+            return *m_Begin;
+        }
+
+        //! \brief Get the first element of the container.
+        [[nodiscard]] inline const T& Front() const noexcept
+        {
+            UN_Assert(!Empty(), "List was empty");
+            return *m_Begin;
+        }
+
+        //! \brief Get the last element of the container.
+        [[nodiscard]] inline T& Back() noexcept
+        {
+            UN_Assert(!Empty(), "List was empty");
+            return *(m_End - 1);
+        }
+
+        //! \brief Get the last element of the container.
+        [[nodiscard]] inline const T& Back() const noexcept
+        {
+            UN_Assert(!Empty(), "List was empty");
+            return *(m_End - 1);
+        }
+
+        //! \brief Get the pointer to the first element of the container.
+        [[nodiscard]] inline T* Data() noexcept
+        {
+            return m_Begin;
+        }
+
+        //! \brief Get the pointer to the first element of the container.
+        [[nodiscard]] inline const T* Data() const noexcept
+        {
+            return m_Begin;
+        }
+
+        [[nodiscard]] inline operator ArraySlice<T>() noexcept
+        {
+            return ArraySlice<T>(m_Begin, Size());
+        }
+
+        [[nodiscard]] inline operator ArraySlice<const T>() const noexcept
+        {
+            return ArraySlice<const T>(m_Begin, Size());
+        }
+
+        inline T* begin() noexcept
+        {
+            return m_Begin;
+        }
+
+        inline const T* begin() const noexcept
+        {
+            return m_Begin;
+        }
+
+        inline T* end() noexcept
+        {
+            return m_End;
+        }
+
+        inline const T* end() const noexcept
+        {
+            return m_End;
+        }
+    };
+} // namespace UN
@@ -0,0 +1,607 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/Utils/BitUtils.h>
+#include <iterator>
+#include <utility>
+
+namespace UN::Internal
+{
+    template<class T, class = void>
+    struct IsTransparent : std::false_type
+    {
+    };
+
+    template<class T>
+    struct IsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type
+    {
+    };
+
+    //! \brief A group of 16 control bytes of HashTable that is matched with a single SSE2 comparison.
+    class HashGroup final
+    {
+        __m128i m_Control;
+
+    public:
+        inline static constexpr USize Width = 16;
+
+        UN_FINLINE explicit HashGroup(const Int8* pControl) noexcept
+            : m_Control(_mm_load_si128(reinterpret_cast<const __m128i*>(pControl)))
+        {
+        }
+
+        //! \brief Get a bit mask of the control bytes that are equal to the specified value.
+        [[nodiscard]] UN_FINLINE UInt32 Match(Int8 value) const noexcept
+        {
+            return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), m_Control)));
+        }
+
+        //! \brief Get a bit mask of the empty and deleted slots, i.e. of the control bytes with the sign bit set.
+        [[nodiscard]] UN_FINLINE UInt32 MatchEmptyOrDeleted() const noexcept
+        {
+            return static_cast<UInt32>(_mm_movemask_epi8(m_Control));
+        }
+    };
+
+    //! \brief An iterator over the occupied slots of HashTable.
+    template<class TSlot>
+    class HashTableIterator final
+    {
+        const Int8* m_pControl = nullptr;
+        const Int8* m_pControlEnd = nullptr;
+        TSlot* m_pSlot = nullptr;
+
+        UN_FINLINE void SkipEmpty() noexcept
+        {
+            while (m_pControl != m_pControlEnd && *m_pControl < 0)
+            {
+                ++m_pControl;
+                ++m_pSlot;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = std::remove_const_t<TSlot>;
+        using pointer           = TSlot*;
+        using reference         = TSlot&;
+
+        inline HashTableIterator() = default;
+
+        inline HashTableIterator(const Int8* pControl, const Int8* pControlEnd, TSlot* pSlot, bool skipEmpty) noexcept
+            : m_pControl(pControl)
+            , m_pControlEnd(pControlEnd)
+            , m_pSlot(pSlot)
+        {
+            if (skipEmpty)
+            {
+                SkipEmpty();
+            }
+        }
+
+        template<class TOther, class = std::enable_if_t<std::is_same_v<const TOther, TSlot>>>
+        inline HashTableIterator(const HashTableIterator<TOther>& other) noexcept // NOLINT
+            : m_pControl(other.GetControl())
+            , m_pControlEnd(other.GetControlEnd())
+            , m_pSlot(other.operator->())
+        {
+        }
+
+        [[nodiscard]] inline const Int8* GetControl() const noexcept
+        {
+            return m_pControl;
+        }
+
+        [[nodiscard]] inline const Int8* GetControlEnd() const noexcept
+        {
+            return m_pControlEnd;
+        }
+
+        inline reference operator*() const noexcept
+        {
+            return *m_pSlot;
+        }
+
+        inline pointer operator->() const noexcept
+        {
+            return m_pSlot;
+        }
+
+        inline HashTableIterator& operator++() noexcept
+        {
+            ++m_pControl;
+            ++m_pSlot;
+            SkipEmpty();
+            return *this;
+        }
+
+        inline HashTableIterator operator++(int) noexcept
+        {
+            HashTableIterator t = *this;
+            ++(*this);
+            return t;
+        }
+
+        inline friend bool operator==(const HashTableIterator& lhs, const HashTableIterator& rhs) noexcept
+        {
+            return lhs.m_pSlot == rhs.m_pSlot;
+        }
+
+        inline friend bool operator!=(const HashTableIterator& lhs, const HashTableIterator& rhs) noexcept
+        {
+            return lhs.m_pSlot != rhs.m_pSlot;
+        }
+    };
+
+    //! \brief An open addressing hash table with Swiss table style control bytes. Used by HashMap and HashSet.
+    //!
+    //! Every slot has a corresponding control byte that is either Empty, Deleted (a tombstone) or holds
+    //! the lower 7 bits of the hash of the key stored in the slot. The slots are split into groups of 16,
+    //! lookup probes the groups using quadratic probing and compares all the control bytes of a group
+    //! with the key hash using a single SSE2 instruction. The keys are only compared for the matching bytes.
+    //!
+    //! The capacity is always a power of two and a multiple of the group size, so the groups are aligned.
+    //! The table is rehashed when the number of occupied and deleted slots reaches 7/8 of the capacity.
+    //! The control bytes and the slots are stored in a single memory block allocated from an IAllocator.
+    //!
+    //! \tparam TPolicy   - A structure that defines KeyType, SlotType and GetKey(const SlotType&).
+    //! \tparam THasher   - The hash function object.
+    //! \tparam TKeyEqual - The key comparison function object.
+    template<class TPolicy, class THasher, class TKeyEqual>
+    class HashTable final
+    {
+    public:
+        using KeyType  = typename TPolicy::KeyType;
+        using SlotType = typename TPolicy::SlotType;
+
+        //! \brief True if a key of type TLookup can be used to find a key of type KeyType without a conversion.
+        template<class TLookup>
+        inline static constexpr bool IsLookupType = std::is_same_v<TLookup, KeyType>
+            || (IsTransparent<THasher>::value && IsTransparent<TKeyEqual>::value
+                && std::is_invocable_v<const THasher&, const TLookup&>);
+
+    private:
+        inline static constexpr Int8 EmptyControl   = -128;
+        inline static constexpr Int8 DeletedControl = -2;
+        inline static constexpr USize Alignment     = std::max(HashGroup::Width, alignof(SlotType));
+
+        Int8* m_pControl         = nullptr;
+        SlotType* m_pSlots       = nullptr;
+        USize m_Capacity         = 0;
+        USize m_Size             = 0;
+        USize m_GrowthLeft       = 0;
+        IAllocator* m_pAllocator = SystemAllocator::Get();
+        THasher m_Hasher;
+        TKeyEqual m_KeyEqual;
+
+        class ProbeSequence final
+        {
+            USize m_Mask;
+            USize m_Group;
+            USize m_Index = 0;
+
+        public:
+            UN_FINLINE ProbeSequence(USize hash, USize capacity) noexcept
+                : m_Mask(capacity / HashGroup::Width - 1)
+                , m_Group(H1(hash) & m_Mask)
+            {
+            }
+
+            [[nodiscard]] UN_FINLINE USize GetOffset() const noexcept
+            {
+                return m_Group * HashGroup::Width;
+            }
+
+            UN_FINLINE void Next() noexcept
+            {
+                ++m_Index;
+                m_Group = (m_Group + m_Index) & m_Mask;
+            }
+        };
+
+        [[nodiscard]] UN_FINLINE static USize H1(USize hash) noexcept
+        {
+            return hash >> 7;
+        }
+
+        [[nodiscard]] UN_FINLINE static Int8 H2(USize hash) noexcept
+        {
+            return static_cast<Int8>(hash & 0x7F);
+        }
+
+        [[nodiscard]] UN_FINLINE static USize GetMaxLoad(USize capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        [[nodiscard]] UN_FINLINE static USize GetSlotsOffset(USize capacity) noexcept
+        {
+            return AlignUp(capacity, Alignment);
+        }
+
+        [[nodiscard]] UN_FINLINE static USize GetAllocationSize(USize capacity) noexcept
+        {
+            return GetSlotsOffset(capacity) + capacity * sizeof(SlotType);
+        }
+
+        //! \brief Get the key itself if it can be used for lookup, otherwise convert it to KeyType.
+        template<class TLookup>
+        [[nodiscard]] UN_FINLINE static decltype(auto) GetLookupKey(const TLookup& key)
+        {
+            if constexpr (IsLookupType<TLookup>)
+            {
+                return (key);
+            }
+            else
+            {
+                return KeyType(key);
+            }
+        }
+
+        template<class TLookup>
+        [[nodiscard]] UN_FINLINE USize HashKey(const TLookup& key) const
+        {
+            // std::hash is the identity function for integers in some implementations: mix the bits so that
+            // both the group index (the high bits) and the control byte (the low 7 bits) are well distributed.
+            UInt64 hash = static_cast<UInt64>(m_Hasher(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<USize>(hash ^ (hash >> 32));
+        }
+
+        template<class TLookup>
+        [[nodiscard]] inline SlotType* FindImpl(const TLookup& key, USize hash) const
+        {
+            const Int8 h2 = H2(hash);
+            ProbeSequence sequence(hash, m_Capacity);
+            while (true)
+            {
+                const USize offset = sequence.GetOffset();
+                HashGroup group(m_pControl + offset);
+                for (UInt32 mask = group.Match(h2); mask != 0; mask &= mask - 1)
+                {
+                    SlotType* pSlot = m_pSlots + offset + Bits::CountTrailingZeros(mask);
+                    if (m_KeyEqual(TPolicy::GetKey(*pSlot), key))
+                    {
+                        return pSlot;
+                    }
+                }
+
+                if (group.Match(EmptyControl) != 0)
+                {
+                    return nullptr;
+                }
+
+                sequence.Next();
+            }
+        }
+
+        [[nodiscard]] inline USize FindFirstNonFull(USize hash) const noexcept
+        {
+            ProbeSequence sequence(hash, m_Capacity);
+            while (true)
+            {
+                HashGroup group(m_pControl + sequence.GetOffset());
+                UInt32 mask = group.MatchEmptyOrDeleted();
+                if (mask != 0)
+                {
+                    return sequence.GetOffset() + Bits::CountTrailingZeros(mask);
+                }
+
+                sequence.Next();
+            }
+        }
+
+        inline static void RelocateSlot(SlotType* pDest, SlotType* pSource) noexcept
+        {
+            if constexpr (TPolicy::IsTriviallyRelocatable)
+            {
+                memcpy(static_cast<void*>(pDest), static_cast<const void*>(pSource), sizeof(SlotType));
+            }
+            else
+            {
+                new (pDest) SlotType(std::move(*pSource));
+                pSource->~SlotType();
+            }
+        }
+
+        inline void DestroySlots() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<SlotType>)
+            {
+                for (USize i = 0; i < m_Capacity; ++i)
+                {
+                    if (m_pControl[i] >= 0)
+                    {
+                        m_pSlots[i].~SlotType();
+                    }
+                }
+            }
+        }
+
+        inline void Deallocate() noexcept
+        {
+            if (m_pControl)
+            {
+                m_pAllocator->Deallocate(m_pControl, GetAllocationSize(m_Capacity), Alignment);
+            }
+
+            m_pControl   = nullptr;
+            m_pSlots     = nullptr;
+            m_Capacity   = 0;
+            m_Size       = 0;
+            m_GrowthLeft = 0;
+        }
+
+        inline void Rehash(USize newCapacity)
+        {
+            UN_Assert(newCapacity % HashGroup::Width == 0 && (newCapacity & (newCapacity - 1)) == 0, "Invalid capacity");
+            UN_Assert(GetMaxLoad(newCapacity) >= m_Size, "Capacity is too small");
+
+            Int8* pOldControl   = m_pControl;
+            SlotType* pOldSlots = m_pSlots;
+            USize oldCapacity   = m_Capacity;
+
+            auto* pData = static_cast<UInt8*>(m_pAllocator->Allocate(GetAllocationSize(newCapacity), Alignment));
+            m_pControl  = reinterpret_cast<Int8*>(pData);
+            m_pSlots    = reinterpret_cast<SlotType*>(pData + GetSlotsOffset(newCapacity));
+            m_Capacity  = newCapacity;
+            memset(m_pControl, EmptyControl, newCapacity);
+
+            for (USize i = 0; i < oldCapacity; ++i)
+            {
+                if (pOldControl[i] < 0)
+                {
+                    continue;
+                }
+
+                USize hash        = HashKey(TPolicy::GetKey(pOldSlots[i]));
+                USize index       = FindFirstNonFull(hash);
+                m_pControl[index] = H2(hash);
+                RelocateSlot(m_pSlots + index, pOldSlots + i);
+            }
+
+            m_GrowthLeft = GetMaxLoad(newCapacity) - m_Size;
+            if (pOldControl)
+            {
+                m_pAllocator->Deallocate(pOldControl, GetAllocationSize(oldCapacity), Alignment);
+            }
+        }
+
+        inline void Grow()
+        {
+            if (m_Capacity == 0)
+            {
+                Rehash(HashGroup::Width);
+            }
+            else if (m_Size <= GetMaxLoad(m_Capacity) / 2)
+            {
+                // Most of the used slots are tombstones, reclaim them without growing.
+                Rehash(m_Capacity);
+            }
+            else
+            {
+                Rehash(m_Capacity * 2);
+            }
+        }
+
+        inline void CopyFrom(const HashTable& other)
+        {
+            Reserve(other.m_Size);
+            for (USize i = 0; i < other.m_Capacity; ++i)
+            {
+                if (other.m_pControl[i] >= 0)
+                {
+                    const SlotType& slot = other.m_pSlots[i];
+                    USize hash           = HashKey(TPolicy::GetKey(slot));
+                    new (PrepareInsert(hash)) SlotType(slot);
+                }
+            }
+        }
+
+    public:
+        inline HashTable() = default;
+
+        inline explicit HashTable(IAllocator* pAllocator) noexcept
+            : m_pAllocator(pAllocator)
+        {
+        }
+
+        inline HashTable(const HashTable& other)
+            : m_pAllocator(other.m_pAllocator)
+            , m_Hasher(other.m_Hasher)
+            , m_KeyEqual(other.m_KeyEqual)
+        {
+            CopyFrom(other);
+        }
+
+        inline HashTable(HashTable&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        inline HashTable& operator=(const HashTable& other)
+        {
+            if (this != &other)
+            {
+                Clear();
+                CopyFrom(other);
+            }
+
+            return *this;
+        }
+
+        inline HashTable& operator=(HashTable&& other) noexcept
+        {
+            Swap(other);
+            return *this;
+        }
+
+        inline ~HashTable()
+        {
+            DestroySlots();
+            Deallocate();
+        }
+
+        inline void Swap(HashTable& other) noexcept
+        {
+            std::swap(m_pControl, other.m_pControl);
+            std::swap(m_pSlots, other.m_pSlots);
+            std::swap(m_Capacity, other.m_Capacity);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_GrowthLeft, other.m_GrowthLeft);
+            std::swap(m_pAllocator, other.m_pAllocator);
+            std::swap(m_Hasher, other.m_Hasher);
+            std::swap(m_KeyEqual, other.m_KeyEqual);
+        }
+
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            return m_Size;
+        }
+
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Capacity;
+        }
+
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_pAllocator;
+        }
+
+        //! \brief Make sure that the table can hold n elements without rehashing.
+        inline void Reserve(USize n)
+        {
+            USize capacity = HashGroup::Width;
+            while (GetMaxLoad(capacity) < n)
+            {
+                capacity *= 2;
+            }
+
+            if (capacity > m_Capacity)
+            {
+                Rehash(capacity);
+            }
+        }
+
+        //! \brief Destroy all elements, doesn't free the memory.
+        inline void Clear() noexcept
+        {
+            if (m_Size == 0 && m_GrowthLeft == GetMaxLoad(m_Capacity))
+            {
+                return;
+            }
+
+            DestroySlots();
+            memset(m_pControl, EmptyControl, m_Capacity);
+            m_Size       = 0;
+            m_GrowthLeft = GetMaxLoad(m_Capacity);
+        }
+
+        //! \brief Find a slot that holds the specified key.
+        //!
+        //! If TLookup is not a valid lookup type (see IsLookupType), the key is converted to KeyType first.
+        //!
+        //! \return The slot or nullptr if the key was not found.
+        template<class TLookup>
+        [[nodiscard]] inline SlotType* Find(const TLookup& key) const
+        {
+            if (m_Size == 0)
+            {
+                return nullptr;
+            }
+
+            const auto& lookupKey = GetLookupKey(key);
+            return FindImpl(lookupKey, HashKey(lookupKey));
+        }
+
+        //! \brief Mark a slot for the key with the specified hash as occupied.
+        //!
+        //! \return The slot, the caller must construct the element in place.
+        inline SlotType* PrepareInsert(USize hash)
+        {
+            if (m_Capacity == 0)
+            {
+                Grow();
+            }
+
+            USize index = FindFirstNonFull(hash);
+            if (m_GrowthLeft == 0 && m_pControl[index] != DeletedControl)
+            {
+                Grow();
+                index = FindFirstNonFull(hash);
+            }
+
+            m_GrowthLeft -= m_pControl[index] == EmptyControl;
+            m_pControl[index] = H2(hash);
+            ++m_Size;
+            return m_pSlots + index;
+        }
+
+        //! \brief Find a slot that holds the specified key or prepare a new one.
+        //!
+        //! \return The slot and true if the key was found. If the key was not found, the caller must
+        //!         construct the element in the returned slot.
+        template<class TLookup>
+        inline std::pair<SlotType*, bool> FindOrPrepareInsert(const TLookup& key)
+        {
+            static_assert(IsLookupType<TLookup>, "Convert the key to KeyType before the insertion");
+
+            USize hash = HashKey(key);
+            if (m_Size != 0)
+            {
+                if (SlotType* pSlot = FindImpl(key, hash))
+                {
+                    return { pSlot, true };
+                }
+            }
+
+            return { PrepareInsert(hash), false };
+        }
+
+        //! \brief Destroy the element in the specified slot.
+        inline void Erase(SlotType* pSlot) noexcept
+        {
+            USize index = pSlot - m_pSlots;
+            UN_Assert(index < m_Capacity && m_pControl[index] >= 0, "Invalid slot");
+
+            pSlot->~SlotType();
+            --m_Size;
+
+            // If the group has an empty slot, no probe sequence has ever passed through it.
+            HashGroup group(m_pControl + AlignDown<HashGroup::Width>(index));
+            if (group.Match(EmptyControl) != 0)
+            {
+                m_pControl[index] = EmptyControl;
+                ++m_GrowthLeft;
+            }
+            else
+            {
+                m_pControl[index] = DeletedControl;
+            }
+        }
+
+        template<class TSlot>
+        [[nodiscard]] inline HashTableIterator<TSlot> MakeIterator(TSlot* pSlot) const noexcept
+        {
+            if (pSlot == nullptr)
+            {
+                return End<TSlot>();
+            }
+
+            return { m_pControl + (pSlot - m_pSlots), m_pControl + m_Capacity, pSlot, false };
+        }
+
+        template<class TSlot>
+        [[nodiscard]] inline HashTableIterator<TSlot> Begin() const noexcept
+        {
+            return { m_pControl, m_pControl + m_Capacity, m_pSlots, true };
+        }
+
+        template<class TSlot>
+        [[nodiscard]] inline HashTableIterator<TSlot> End() const noexcept
+        {
+            return { m_pControl + m_Capacity, m_pControl + m_Capacity, m_pSlots + m_Capacity, false };
+        }
+    };
+} // namespace UN::Internal
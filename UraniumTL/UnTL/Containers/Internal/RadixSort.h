@@ -0,0 +1,96 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Memory/IAllocator.h>
+
+namespace UN::Internal
+{
+    //! \brief True if values of type TKey can be used as radix sort keys.
+    template<class TKey>
+    inline constexpr bool IsRadixSortKey =
+        (std::is_integral_v<TKey> && !std::is_same_v<TKey, bool>) || std::is_enum_v<TKey>;
+
+    //! \brief Smaller lists are sorted with std::sort, the radix sort histogram pass doesn't pay off for them.
+    inline constexpr USize RadixSortThreshold = 256;
+
+    //! \brief Convert a key to an unsigned integer with the same ordering.
+    template<class TKey>
+    UN_FINLINE auto ToRadixKey(TKey key, bool descending) noexcept
+    {
+        using TInt      = std::conditional_t<std::is_enum_v<TKey>, std::underlying_type<TKey>, std::common_type<TKey>>;
+        using TUnsigned = std::make_unsigned_t<typename TInt::type>;
+
+        auto result = static_cast<TUnsigned>(key);
+        if constexpr (std::is_signed_v<typename TInt::type>)
+        {
+            result ^= TUnsigned(1) << (sizeof(TUnsigned) * 8 - 1);
+        }
+
+        return descending ? static_cast<TUnsigned>(~result) : result;
+    }
+
+    //! \brief Sort elements by an integer key using least significant digit radix sort.
+    //!
+    //! The sort is stable and takes O(N * sizeof(key)) time. The elements are relocated between the array
+    //! and a temporary buffer with memcpy, so T must be trivially relocatable. The passes where all the keys
+    //! have the same digit are skipped.
+    //!
+    //! \param pAllocator - The allocator for the temporary buffer.
+    //! \param pData      - The elements to sort.
+    //! \param length     - The number of elements.
+    //! \param getKey     - A function that returns the key of an element.
+    //! \param descending - True if the elements must be sorted in descending order.
+    template<class T, class TKeyFunc>
+    inline void RadixSort(IAllocator* pAllocator, T* pData, USize length, TKeyFunc&& getKey, bool descending)
+    {
+        static_assert(IsTriviallyRelocatable<T>::value, "Radix sort requires trivially relocatable elements");
+
+        using TKey = decltype(ToRadixKey(getKey(*pData), false));
+
+        constexpr USize digitCount = sizeof(TKey);
+        USize histograms[digitCount][256] = {};
+        for (USize i = 0; i < length; ++i)
+        {
+            const TKey key = ToRadixKey(getKey(pData[i]), descending);
+            for (USize digit = 0; digit < digitCount; ++digit)
+            {
+                ++histograms[digit][(key >> (digit * 8)) & 0xFF];
+            }
+        }
+
+        T* pBuffer = static_cast<T*>(pAllocator->Allocate(length * sizeof(T), alignof(T)));
+        T* pSource = pData;
+        T* pDest   = pBuffer;
+        for (USize digit = 0; digit < digitCount; ++digit)
+        {
+            USize* pHistogram = histograms[digit];
+            const TKey firstKey = ToRadixKey(getKey(*pSource), descending);
+            if (pHistogram[(firstKey >> (digit * 8)) & 0xFF] == length)
+            {
+                continue;
+            }
+
+            USize offset = 0;
+            for (USize i = 0; i < 256; ++i)
+            {
+                const USize count = pHistogram[i];
+                pHistogram[i]     = offset;
+                offset += count;
+            }
+
+            for (USize i = 0; i < length; ++i)
+            {
+                const TKey key = ToRadixKey(getKey(pSource[i]), descending);
+                memcpy(static_cast<void*>(&pDest[pHistogram[(key >> (digit * 8)) & 0xFF]++]), &pSource[i], sizeof(T));
+            }
+
+            std::swap(pSource, pDest);
+        }
+
+        if (pSource != pData)
+        {
+            memcpy(static_cast<void*>(pData), pSource, length * sizeof(T));
+        }
+
+        pAllocator->Deallocate(pBuffer, length * sizeof(T), alignof(T));
+    }
+} // namespace UN::Internal
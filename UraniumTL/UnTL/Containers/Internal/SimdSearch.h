@@ -0,0 +1,367 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Utils/BitUtils.h>
+
+#if UN_AVX2_SUPPORTED
+#    include <immintrin.h>
+#endif
+
+namespace UN::Internal
+{
+    //! \brief True if elements of type T can be searched with the SIMD kernels below.
+    //!
+    //! Integers, enums and pointers are compared bitwise, floating point numbers are compared using ordered
+    //! floating point comparison, which gives the same results as operator== (NaN is never found, 0.0 == -0.0).
+    template<class T>
+    inline constexpr bool IsSimdSearchable =
+        (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T> || std::is_floating_point_v<T>)
+        && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    //! \brief Maximum number of values supported by SimdFindFirstOfAny and SimdFindLastOfAny.
+    inline constexpr USize SimdSearchMaxValues = 4;
+
+    template<class T>
+    UN_FINLINE auto BitCastToInteger(T value) noexcept
+    {
+        using TInt = std::conditional_t<sizeof(T) == 1, Int8,
+                                        std::conditional_t<sizeof(T) == 2, Int16, std::conditional_t<sizeof(T) == 4, Int32, Int64>>>;
+        TInt result;
+        memcpy(&result, &value, sizeof(T));
+        return result;
+    }
+
+    struct Sse2SearchOps
+    {
+        using Vector = __m128i;
+
+        inline static constexpr USize Width = 16;
+
+        UN_FINLINE static Vector Load(const void* pData) noexcept
+        {
+            return _mm_loadu_si128(static_cast<const __m128i*>(pData));
+        }
+
+        template<class T>
+        UN_FINLINE static Vector Broadcast(T value) noexcept
+        {
+            auto x = BitCastToInteger(value);
+            if constexpr (sizeof(T) == 1)
+                return _mm_set1_epi8(x);
+            else if constexpr (sizeof(T) == 2)
+                return _mm_set1_epi16(x);
+            else if constexpr (sizeof(T) == 4)
+                return _mm_set1_epi32(x);
+            else
+                return _mm_set1_epi64x(x);
+        }
+
+        //! \brief Compare the elements and get a mask with sizeof(T) bits set for each equal element.
+        template<class T>
+        UN_FINLINE static UInt32 Match(Vector a, Vector b) noexcept
+        {
+            Vector result;
+            if constexpr (std::is_same_v<T, float>)
+            {
+                result = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                static_assert(sizeof(T) == 8, "Unsupported floating point type");
+                result = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+            }
+            else if constexpr (sizeof(T) == 1)
+            {
+                result = _mm_cmpeq_epi8(a, b);
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                result = _mm_cmpeq_epi16(a, b);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                result = _mm_cmpeq_epi32(a, b);
+            }
+            else
+            {
+                // SSE2 doesn't have a 64-bit comparison: both 32-bit halves must be equal.
+                result = _mm_cmpeq_epi32(a, b);
+                result = _mm_and_si128(result, _mm_shuffle_epi32(result, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+
+            return static_cast<UInt32>(_mm_movemask_epi8(result));
+        }
+    };
+
+#if UN_AVX2_SUPPORTED
+    struct Avx2SearchOps
+    {
+        using Vector = __m256i;
+
+        inline static constexpr USize Width = 32;
+
+        UN_FINLINE static Vector Load(const void* pData) noexcept
+        {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(pData));
+        }
+
+        template<class T>
+        UN_FINLINE static Vector Broadcast(T value) noexcept
+        {
+            auto x = BitCastToInteger(value);
+            if constexpr (sizeof(T) == 1)
+                return _mm256_set1_epi8(x);
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_set1_epi16(x);
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_set1_epi32(x);
+            else
+                return _mm256_set1_epi64x(x);
+        }
+
+        //! \brief Compare the elements and get a mask with sizeof(T) bits set for each equal element.
+        template<class T>
+        UN_FINLINE static UInt32 Match(Vector a, Vector b) noexcept
+        {
+            Vector result;
+            if constexpr (std::is_same_v<T, float>)
+            {
+                result = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                static_assert(sizeof(T) == 8, "Unsupported floating point type");
+                result = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+            }
+            else if constexpr (sizeof(T) == 1)
+            {
+                result = _mm256_cmpeq_epi8(a, b);
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                result = _mm256_cmpeq_epi16(a, b);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                result = _mm256_cmpeq_epi32(a, b);
+            }
+            else
+            {
+                result = _mm256_cmpeq_epi64(a, b);
+            }
+
+            return static_cast<UInt32>(_mm256_movemask_epi8(result));
+        }
+    };
+#endif
+
+    template<class T, USize N>
+    UN_FINLINE bool IsEqualToAny(const T& x, const T (&values)[N]) noexcept
+    {
+        for (USize i = 0; i < N; ++i)
+        {
+            if (x == values[i])
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! \brief Search full vectors starting at index, returns the found index or -1 and the index of the first unsearched element.
+    template<class TOps, class T, USize N>
+    UN_FINLINE SSize SimdFindFirstBlocks(const T* pData, USize& index, USize length, const T (&values)[N]) noexcept
+    {
+        constexpr USize step = TOps::Width / sizeof(T);
+        if (index + step > length)
+        {
+            return -1;
+        }
+
+        typename TOps::Vector needles[N];
+        for (USize i = 0; i < N; ++i)
+        {
+            needles[i] = TOps::Broadcast(values[i]);
+        }
+
+        for (; index + step <= length; index += step)
+        {
+            const auto haystack = TOps::Load(pData + index);
+
+            UInt32 mask = 0;
+            for (USize i = 0; i < N; ++i)
+            {
+                mask |= TOps::template Match<T>(haystack, needles[i]);
+            }
+
+            if (mask != 0)
+            {
+                return static_cast<SSize>(index + Bits::CountTrailingZeros(mask) / sizeof(T));
+            }
+        }
+
+        return -1;
+    }
+
+    //! \brief Search full vectors that end at index, returns the found index or -1 and the end of the unsearched elements.
+    template<class TOps, class T, USize N>
+    UN_FINLINE SSize SimdFindLastBlocks(const T* pData, USize& index, const T (&values)[N]) noexcept
+    {
+        constexpr USize step = TOps::Width / sizeof(T);
+        if (index < step)
+        {
+            return -1;
+        }
+
+        typename TOps::Vector needles[N];
+        for (USize i = 0; i < N; ++i)
+        {
+            needles[i] = TOps::Broadcast(values[i]);
+        }
+
+        while (index >= step)
+        {
+            index -= step;
+            const auto haystack = TOps::Load(pData + index);
+
+            UInt32 mask = 0;
+            for (USize i = 0; i < N; ++i)
+            {
+                mask |= TOps::template Match<T>(haystack, needles[i]);
+            }
+
+            if (mask != 0)
+            {
+                return static_cast<SSize>(index + (31 - Bits::CountLeadingZeros(mask)) / sizeof(T));
+            }
+        }
+
+        return -1;
+    }
+
+    //! \brief Find the first element equal to one of the values using SIMD, see IsSimdSearchable.
+    //!
+    //! Uses AVX2 if it was enabled at compile time, SSE2 otherwise.
+    //!
+    //! \return The index of the element or -1.
+    template<class T, USize N>
+    inline SSize SimdFindFirstOfAny(const T* pData, USize length, const T (&values)[N]) noexcept
+    {
+        static_assert(IsSimdSearchable<T> && N <= SimdSearchMaxValues);
+
+        USize index = 0;
+#if UN_AVX2_SUPPORTED
+        if (SSize result = SimdFindFirstBlocks<Avx2SearchOps>(pData, index, length, values); result >= 0)
+        {
+            return result;
+        }
+#endif
+        if (SSize result = SimdFindFirstBlocks<Sse2SearchOps>(pData, index, length, values); result >= 0)
+        {
+            return result;
+        }
+
+        for (; index < length; ++index)
+        {
+            if (IsEqualToAny(pData[index], values))
+            {
+                return static_cast<SSize>(index);
+            }
+        }
+
+        return -1;
+    }
+
+    //! \brief Find the last element equal to one of the values using SIMD, see IsSimdSearchable.
+    //!
+    //! Uses AVX2 if it was enabled at compile time, SSE2 otherwise.
+    //!
+    //! \return The index of the element or -1.
+    template<class T, USize N>
+    inline SSize SimdFindLastOfAny(const T* pData, USize length, const T (&values)[N]) noexcept
+    {
+        static_assert(IsSimdSearchable<T> && N <= SimdSearchMaxValues);
+
+        USize index = length;
+#if UN_AVX2_SUPPORTED
+        if (SSize result = SimdFindLastBlocks<Avx2SearchOps>(pData, index, values); result >= 0)
+        {
+            return result;
+        }
+#endif
+        if (SSize result = SimdFindLastBlocks<Sse2SearchOps>(pData, index, values); result >= 0)
+        {
+            return result;
+        }
+
+        while (index > 0)
+        {
+            --index;
+            if (IsEqualToAny(pData[index], values))
+            {
+                return static_cast<SSize>(index);
+            }
+        }
+
+        return -1;
+    }
+
+    //! \brief Find the first element equal to the value using SIMD, see IsSimdSearchable.
+    template<class T>
+    inline SSize SimdFindFirstOf(const T* pData, USize length, T value) noexcept
+    {
+        const T values[] = { value };
+        return SimdFindFirstOfAny(pData, length, values);
+    }
+
+    //! \brief Find the last element equal to the value using SIMD, see IsSimdSearchable.
+    template<class T>
+    inline SSize SimdFindLastOf(const T* pData, USize length, T value) noexcept
+    {
+        const T values[] = { value };
+        return SimdFindLastOfAny(pData, length, values);
+    }
+
+    template<class TOps, class T, class TFunc>
+    UN_FINLINE void SimdForEachMatchBlocks(const T* pData, USize& index, USize length, T value, TFunc& f)
+    {
+        const auto needle = TOps::Broadcast(value);
+        for (; index + TOps::Width <= length; index += TOps::Width)
+        {
+            const USize base = index;
+            Bits::ForEachSetBit(TOps::template Match<T>(TOps::Load(pData + index), needle), [&f, base](UInt32 bit) {
+                f(base + bit);
+            });
+        }
+    }
+
+    //! \brief Call a function for the index of every byte equal to the value, in ascending order.
+    //!
+    //! Scans the data once and gets a bit mask of matches for every vector, which is cheaper than calling
+    //! SimdFindFirstOf after every match when the matches are frequent. Uses AVX2 if it was enabled at
+    //! compile time, SSE2 otherwise.
+    //!
+    //! Function signature:
+    //! \code{.cpp}
+    //!     void f(USize index);
+    //! \endcode
+    template<class T, class TFunc>
+    inline void SimdForEachMatch(const T* pData, USize length, T value, TFunc&& f)
+    {
+        static_assert(IsSimdSearchable<T> && sizeof(T) == 1);
+
+        USize index = 0;
+#if UN_AVX2_SUPPORTED
+        SimdForEachMatchBlocks<Avx2SearchOps>(pData, index, length, value, f);
+#endif
+        SimdForEachMatchBlocks<Sse2SearchOps>(pData, index, length, value, f);
+
+        for (; index < length; ++index)
+        {
+            if (pData[index] == value)
+            {
+                f(index);
+            }
+        }
+    }
+} // namespace UN::Internal
@@ -1,4 +1,6 @@
 #pragma once
+#include <UnTL/Containers/Internal/RadixSort.h>
+#include <UnTL/Containers/Internal/SimdSearch.h>
 #include <UnTL/Memory/Memory.h>
 #include <algorithm>
 #include <tuple>
@@ -9,6 +11,10 @@ namespace UN
     //!
     //! Memory allocations in the list are always aligned to 16 bytes. I.e. the pointer to the first element
     //! has 16-byte alignment, but the rest are stored tightly packed.
+    //!
+    //! The memory is allocated from the IAllocator passed to the constructor, or from SystemAllocator if none
+    //! was specified. The allocator must outlive the list. Moves and copy construction take the allocator
+    //! of the source list, copy assignment keeps the allocator of the destination.
     template<class T>
     class List final
     {
@@ -26,10 +32,9 @@ namespace UN
             return std::make_tuple(GetAt<I>()...);
         }
 
-        inline static T* Allocate(USize n) noexcept
+        inline T* Allocate(USize n) noexcept
         {
-            auto* allocator = SystemAllocator::Get();
-            return static_cast<T*>(allocator->Allocate(n * sizeof(T), Alignment));
+            return static_cast<T*>(m_pAllocator->Allocate(n * sizeof(T), Alignment));
         }
 
         inline void VAllocate(USize n) noexcept
@@ -71,35 +76,42 @@ namespace UN
             m_End = newEnd;
         }
 
-        inline static void Deallocate(T* pointer) noexcept
+        inline void Deallocate(T* pointer, USize n) noexcept
         {
             if (pointer == nullptr)
             {
                 return;
             }
 
-            SystemAllocator::Get()->Deallocate(pointer);
+            m_pAllocator->Deallocate(pointer, n * sizeof(T), Alignment);
+        }
+
+        inline T* Reallocate(T* pointer, USize n, USize newN) noexcept
+        {
+            return static_cast<T*>(m_pAllocator->Reallocate(pointer, n * sizeof(T), newN * sizeof(T), Alignment));
         }
 
         inline void VDeallocate() noexcept
         {
-            Deallocate(m_Begin);
+            Deallocate(m_Begin, Capacity());
             m_Begin  = nullptr;
             m_End    = nullptr;
             m_EndCap = nullptr;
         }
 
-        inline static void MoveData(T* dest, T* src, size_t count) noexcept
+        //! \brief Move elements to uninitialized memory and destroy the source elements.
+        inline static void RelocateData(T* dest, T* src, USize count) noexcept
         {
-            if constexpr (std::is_trivially_copyable_v<T>)
+            if constexpr (IsTriviallyRelocatable<T>::value)
             {
-                memcpy(dest, src, count * sizeof(T));
+                memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(T));
             }
             else
             {
                 for (USize i = 0; i < count; ++i)
                 {
                     new (dest + i) T(std::move(src[i]));
+                    src[i].~T();
                 }
             }
         }
@@ -116,7 +128,7 @@ namespace UN
             {
                 if (shrink)
                 {
-                    newCap = n;
+                    newCap = Size() + n;
                 }
                 else
                 {
@@ -124,16 +136,27 @@ namespace UN
                 }
             }
 
-            if (Empty())
+            // Check the buffer, not the size: a cleared list still owns its memory.
+            if (m_Begin == nullptr)
             {
                 VAllocate(newCap);
                 return;
             }
 
+            if constexpr (IsTriviallyRelocatable<T>::value)
+            {
+                // The allocator might be able to grow the block in place or at least avoid a separate copy.
+                USize size = Size();
+                m_Begin    = Reallocate(m_Begin, Capacity(), newCap);
+                m_End      = m_Begin + size;
+                m_EndCap   = m_Begin + newCap;
+                return;
+            }
+
             T* newBegin = Allocate(newCap);
             T* newEnd   = newBegin + Size();
 
-            MoveData(newBegin, m_Begin, Size());
+            RelocateData(newBegin, m_Begin, Size());
             VDeallocate();
 
             m_Begin  = newBegin;
@@ -141,9 +164,10 @@ namespace UN
             m_EndCap = newBegin + newCap;
         }
 
-        T* m_Begin  = nullptr;
-        T* m_End    = nullptr;
-        T* m_EndCap = nullptr;
+        T* m_Begin               = nullptr;
+        T* m_End                 = nullptr;
+        T* m_EndCap              = nullptr;
+        IAllocator* m_pAllocator = SystemAllocator::Get();
 
     public:
         UN_RTTI_Struct(List<T>, "F478A740-263E-4274-A0CC-3789769262E2");
@@ -156,6 +180,7 @@ namespace UN
         }
 
         inline List(const List& other)
+            : m_pAllocator(other.m_pAllocator)
         {
             Reserve(other.Size());
             for (const auto& v : other)
@@ -172,17 +197,43 @@ namespace UN
 
         inline List& operator=(const List& other)
         {
-            List lst(other);
+            List lst(m_pAllocator);
+            lst.Reserve(other.Size());
+            for (const auto& v : other)
+            {
+                lst.Push(v);
+            }
+
             Swap(lst);
             return *this;
         }
 
+        //! \brief Create an empty list that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit List(IAllocator* pAllocator) noexcept
+            : m_pAllocator(pAllocator)
+        {
+        }
+
         inline List(USize n, const T& x)
         {
             VAllocate(n);
             ConstructAtEnd(n, x);
         }
 
+        //! \brief Create a list of N copies of X that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        //! \param n          - The number of elements.
+        //! \param x          - The element to copy N times.
+        inline List(IAllocator* pAllocator, USize n, const T& x)
+            : m_pAllocator(pAllocator)
+        {
+            VAllocate(n);
+            ConstructAtEnd(n, x);
+        }
+
         inline List(std::initializer_list<T> list)
         {
             Assign(list);
@@ -326,7 +377,7 @@ namespace UN
             if constexpr (std::is_trivially_copyable_v<T>)
             {
                 AppendImpl(n);
-                memcpy(m_End, data, n);
+                memcpy(m_End, data, n * sizeof(T));
                 m_End += n;
             }
             else
@@ -439,6 +490,11 @@ namespace UN
         //! \param value - The value to find.
         inline SSize IndexOf(const T& value) const
         {
+            if constexpr (Internal::IsSimdSearchable<T>)
+            {
+                return Internal::SimdFindFirstOf<T>(m_Begin, Size(), value);
+            }
+
             auto size = static_cast<SSize>(Size());
             for (SSize i = 0; i < size; ++i)
             {
@@ -459,24 +515,80 @@ namespace UN
             return IndexOf(value) != -1;
         }
 
+        //! \brief Insert a new element at index, will move all right values by one to the right.
+        //!
+        //! \param index - The index to insert at, must be less than or equal to Size().
+        //! \param args  - The arguments to the element constructor with.
+        //!
+        //! \return The reference to the inserted element.
+        template<class... Args>
+        inline T& EmplaceAt(USize index, Args&&... args)
+        {
+            assert(index <= Size() && "Invalid index");
+            if (index == Size())
+            {
+                return Emplace(std::forward<Args>(args)...);
+            }
+
+            // The arguments can reference an element of this list, construct before moving the elements.
+            T value(std::forward<Args>(args)...);
+            AppendImpl(1);
+
+            T* pos = m_Begin + index;
+            if constexpr (IsTriviallyRelocatable<T>::value)
+            {
+                memmove(static_cast<void*>(pos + 1), static_cast<const void*>(pos), (m_End - pos) * sizeof(T));
+                new (pos) T(std::move(value));
+            }
+            else
+            {
+                new (m_End) T(std::move(*(m_End - 1)));
+                std::move_backward(pos, m_End - 1, m_End);
+                *pos = std::move(value);
+            }
+
+            ++m_End;
+            return *pos;
+        }
+
+        //! \brief Insert a new element at index and move, will move all right values by one to the right.
+        //!
+        //! \param index - The index to insert at, must be less than or equal to Size().
+        //! \param x     - The element to insert.
+        //!
+        //! \return The reference to the inserted element.
+        inline T& Insert(USize index, T&& x)
+        {
+            return EmplaceAt(index, std::move(x));
+        }
+
+        //! \brief Insert a new element at index and copy, will move all right values by one to the right.
+        //!
+        //! \param index - The index to insert at, must be less than or equal to Size().
+        //! \param x     - The element to insert.
+        //!
+        //! \return The reference to the inserted element.
+        inline T& Insert(USize index, const T& x)
+        {
+            return EmplaceAt(index, x);
+        }
+
         //! \brief Remove value at index, will move all right values by one to the left.
         inline void RemoveAt(USize index)
         {
             assert(index < Size() && "Invalid index");
-            if constexpr (std::is_trivially_copyable_v<T>)
+            if constexpr (IsTriviallyRelocatable<T>::value)
             {
-                memmove(m_Begin + index, m_Begin + index + 1, Size() - index - 1);
+                T* pos = m_Begin + index;
+                pos->~T();
+                memmove(static_cast<void*>(pos), static_cast<const void*>(pos + 1), (m_End - pos - 1) * sizeof(T));
+                --m_End;
             }
             else
             {
-                auto size = Size();
-                for (USize i = index; i < size - 1; ++i)
-                {
-                    m_Begin[i] = m_Begin[i + 1];
-                }
+                std::move(m_Begin + index + 1, m_End, m_Begin + index);
+                DestructAtEnd(m_End - 1);
             }
-
-            DestructAtEnd(m_End - 1);
         }
 
         //! \brief Remove value at index, will swap the last value with the removed value.
@@ -523,6 +635,13 @@ namespace UN
             std::swap(m_Begin, other.m_Begin);
             std::swap(m_End, other.m_End);
             std::swap(m_EndCap, other.m_EndCap);
+            std::swap(m_pAllocator, other.m_pAllocator);
+        }
+
+        //! \brief Get the allocator used by the list.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_pAllocator;
         }
 
         //! \brief Set the capacity to be equal to the size. Useful to free wasted memory.
@@ -544,6 +663,9 @@ namespace UN
 
         //! \brief Sort elements in the container using a member of T as sorting key.
         //!
+        //! Large lists of trivially relocatable elements with an integer or enum member are sorted
+        //! using radix sort, which is stable in this case.
+        //!
         //! \tparam TMember - Type of pointer to member (must implement relational operators).
         //!
         //! \param member     - Pointer to member to use as sorting key.
@@ -552,6 +674,21 @@ namespace UN
         inline void SortByMember(TMember member,
                                  std::enable_if_t<std::is_member_object_pointer_v<TMember>, bool> descending = false)
         {
+            using TKey = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const T&>().*member)>>;
+            if constexpr (Internal::IsRadixSortKey<TKey> && IsTriviallyRelocatable<T>::value)
+            {
+                if (Size() >= Internal::RadixSortThreshold)
+                {
+                    Internal::RadixSort(
+                        m_pAllocator, m_Begin, Size(),
+                        [member](const T& x) {
+                            return x.*member;
+                        },
+                        descending);
+                    return;
+                }
+            }
+
             if (descending)
             {
                 Sort([member](const T& lhs, const T& rhs) {
@@ -601,8 +738,24 @@ namespace UN
         }
 
         //! \brief Sort elements in the container.
+        //!
+        //! Large lists of integers and enums are sorted using radix sort.
         inline void Sort()
         {
+            if constexpr (Internal::IsRadixSortKey<T>)
+            {
+                if (Size() >= Internal::RadixSortThreshold)
+                {
+                    Internal::RadixSort(
+                        m_pAllocator, m_Begin, Size(),
+                        [](T x) {
+                            return x;
+                        },
+                        false);
+                    return;
+                }
+            }
+
             std::sort(m_Begin, m_End);
         }
 
@@ -674,7 +827,7 @@ namespace UN
 
         //! \brief Get the pointer to the first element of the container and reset.
         //!
-        //! \note The caller is responsible to deallocate the memory.
+        //! \note The caller is responsible to deallocate the memory using GetAllocator().
         [[nodiscard]] inline T* DetachData() noexcept
         {
             auto result = m_Begin;
@@ -704,4 +857,9 @@ namespace UN
             return m_End;
         }
     };
+
+    template<class T>
+    struct IsTriviallyRelocatable<List<T>> : std::true_type
+    {
+    };
 } // namespace UN
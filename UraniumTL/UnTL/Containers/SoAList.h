@@ -0,0 +1,508 @@
+#pragma once
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Containers/Internal/RadixSort.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/RTTI/RTTI.h>
+#include <tuple>
+
+namespace UN
+{
+    //! \brief A growable list of records that stores each field in its own contiguous column.
+    //!
+    //! Unlike `List<Struct>`, scanning a single field touches only the memory of that field, so column scans
+    //! use the whole cache bandwidth and can be vectorized (see ArraySlice::FindFirstOf). All the columns
+    //! are stored in a single allocation from the IAllocator passed to the constructor (SystemAllocator by
+    //! default), each column is aligned to 16 bytes.
+    //!
+    //! The columns are accessed by index: `Column<I>()` returns an ArraySlice of the I-th field.
+    //! Operations that reorder the records (RemoveAt, SwapRemoveAt, SortByColumn) apply the same permutation
+    //! to all the columns.
+    //!
+    //! \code{.cpp}
+    //!     SoAList<UInt32, float, String> particles;
+    //!     particles.Push(1, 0.5f, "first");
+    //!     particles.SortByColumn<1>();
+    //!     ArraySlice<float> weights = particles.Column<1>();
+    //! \endcode
+    //!
+    //! \tparam Ts - Types of the fields.
+    template<class... Ts>
+    class SoAList final
+    {
+        static_assert(sizeof...(Ts) > 0, "SoAList must have at least one column");
+        static_assert((... && !std::is_const_v<Ts>));
+
+        inline static constexpr USize Alignment = std::max({ static_cast<USize>(16), alignof(Ts)... });
+
+        using Columns = std::tuple<Ts*...>;
+
+        Columns m_Columns{};
+        USize m_Size             = 0;
+        USize m_Capacity         = 0;
+        IAllocator* m_pAllocator = SystemAllocator::Get();
+
+        [[nodiscard]] inline static USize GetStorageSize(USize capacity) noexcept
+        {
+            return (... + AlignUp<Alignment>(capacity * sizeof(Ts)));
+        }
+
+        [[nodiscard]] inline static Columns GetColumns(void* pStorage, USize capacity) noexcept
+        {
+            auto* pCurrent = static_cast<UInt8*>(pStorage);
+            auto next      = [&pCurrent, capacity](auto* pType) {
+                using T = std::remove_pointer_t<decltype(pType)>;
+
+                auto* pColumn = reinterpret_cast<T*>(pCurrent);
+                pCurrent += AlignUp<Alignment>(capacity * sizeof(T));
+                return pColumn;
+            };
+
+            // Braced initialization guarantees left-to-right evaluation order.
+            return Columns{ next(static_cast<Ts*>(nullptr))... };
+        }
+
+        template<class F>
+        inline void ForEachColumn(F&& f)
+        {
+            std::apply(
+                [&f](auto*... pColumns) {
+                    (f(pColumns), ...);
+                },
+                m_Columns);
+        }
+
+        template<class F>
+        inline static void ForEachColumnPair(Columns& dest, const Columns& source, F&& f)
+        {
+            ForEachColumnPairImpl(dest, source, f, std::index_sequence_for<Ts...>{});
+        }
+
+        template<class F, USize... Is>
+        inline static void ForEachColumnPairImpl(Columns& dest, const Columns& source, F& f, std::index_sequence<Is...>)
+        {
+            (f(std::get<Is>(dest), std::get<Is>(source)), ...);
+        }
+
+        inline void Deallocate()
+        {
+            if (m_Capacity == 0)
+            {
+                return;
+            }
+
+            m_pAllocator->Deallocate(std::get<0>(m_Columns), GetStorageSize(m_Capacity), Alignment);
+            m_Columns  = {};
+            m_Capacity = 0;
+        }
+
+        inline void DestructAll()
+        {
+            ForEachColumn([this](auto* pColumn) {
+                std::destroy(pColumn, pColumn + m_Size);
+            });
+        }
+
+        //! \brief Allocate new storage and move the records to the specified positions.
+        //!
+        //! \param capacity     - The capacity of the new storage.
+        //! \param pPermutation - The index of the old record for each new position, nullptr to keep the order.
+        inline void Relocate(USize capacity, const USize* pPermutation)
+        {
+            Columns newColumns = GetColumns(m_pAllocator->Allocate(GetStorageSize(capacity), Alignment), capacity);
+            ForEachColumnPair(newColumns, m_Columns, [this, pPermutation](auto* pDest, auto* pSource) {
+                using T = std::remove_pointer_t<decltype(pDest)>;
+                if (pPermutation == nullptr && IsTriviallyRelocatable<T>::value)
+                {
+                    if (m_Size > 0)
+                    {
+                        memcpy(static_cast<void*>(pDest), pSource, m_Size * sizeof(T));
+                    }
+
+                    return;
+                }
+
+                for (USize i = 0; i < m_Size; ++i)
+                {
+                    T& source = pSource[pPermutation ? pPermutation[i] : i];
+                    if constexpr (IsTriviallyRelocatable<T>::value)
+                    {
+                        memcpy(static_cast<void*>(&pDest[i]), &source, sizeof(T));
+                    }
+                    else
+                    {
+                        new (&pDest[i]) T(std::move(source));
+                    }
+                }
+
+                if constexpr (!IsTriviallyRelocatable<T>::value)
+                {
+                    std::destroy(pSource, pSource + m_Size);
+                }
+            });
+
+            Deallocate();
+            m_Columns  = newColumns;
+            m_Capacity = capacity;
+        }
+
+        inline void Grow(USize minCapacity)
+        {
+            Relocate(std::max({ minCapacity, m_Capacity * 2, static_cast<USize>(16) }), nullptr);
+        }
+
+        template<USize... Is, class... Args>
+        inline void ConstructAt(USize index, std::index_sequence<Is...>, Args&&... args)
+        {
+            (new (&std::get<Is>(m_Columns)[index]) Ts(std::forward<Args>(args)), ...);
+        }
+
+        template<USize... Is>
+        inline void CopyFrom(const SoAList& other, std::index_sequence<Is...>)
+        {
+            for (USize i = 0; i < other.m_Size; ++i)
+            {
+                ConstructAt(i, std::index_sequence<Is...>{}, std::get<Is>(other.m_Columns)[i]...);
+            }
+
+            m_Size = other.m_Size;
+        }
+
+        template<USize... Is>
+        inline auto GetRecord(USize index, std::index_sequence<Is...>) const noexcept
+        {
+            return std::tie(std::get<Is>(m_Columns)[index]...);
+        }
+
+    public:
+        UN_RTTI_Struct(SoAList, "C5B19F0D-1550-4929-B15C-7E0F45A5CDD0");
+
+        //! \brief Type of the I-th column.
+        template<USize I>
+        using ColumnType = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        //! \brief The number of columns.
+        inline static constexpr USize ColumnCount = sizeof...(Ts);
+
+        inline SoAList() = default;
+
+        //! \brief Create an empty list that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit SoAList(IAllocator* pAllocator) noexcept
+            : m_pAllocator(pAllocator)
+        {
+        }
+
+        inline SoAList(const SoAList& other)
+            : m_pAllocator(other.m_pAllocator)
+        {
+            Reserve(other.m_Size);
+            CopyFrom(other, std::index_sequence_for<Ts...>{});
+        }
+
+        inline SoAList(SoAList&& other) noexcept
+            : m_Columns(other.m_Columns)
+            , m_Size(other.m_Size)
+            , m_Capacity(other.m_Capacity)
+            , m_pAllocator(other.m_pAllocator)
+        {
+            other.m_Columns  = {};
+            other.m_Size     = 0;
+            other.m_Capacity = 0;
+        }
+
+        inline SoAList& operator=(const SoAList& other)
+        {
+            if (this == &other)
+            {
+                return *this;
+            }
+
+            Clear();
+            Reserve(other.m_Size);
+            CopyFrom(other, std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        inline SoAList& operator=(SoAList&& other) noexcept
+        {
+            Swap(other);
+            return *this;
+        }
+
+        inline ~SoAList()
+        {
+            DestructAll();
+            Deallocate();
+        }
+
+        //! \brief Get the number of records.
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            return m_Size;
+        }
+
+        //! \brief Get the number of records the list can hold without reallocation.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Capacity;
+        }
+
+        //! \brief Check if the list is empty.
+        [[nodiscard]] inline bool Empty() const noexcept
+        {
+            return m_Size == 0;
+        }
+
+        //! \brief Check if the list has any records.
+        [[nodiscard]] inline bool Any() const noexcept
+        {
+            return m_Size != 0;
+        }
+
+        //! \brief Get the allocator used by the list.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_pAllocator;
+        }
+
+        //! \brief Make sure the list can hold N records without reallocation.
+        inline void Reserve(USize n)
+        {
+            if (n > m_Capacity)
+            {
+                Relocate(n, nullptr);
+            }
+        }
+
+        //! \brief Remove all the records, doesn't free the memory.
+        inline void Clear()
+        {
+            DestructAll();
+            m_Size = 0;
+        }
+
+        //! \brief Swap two lists.
+        inline void Swap(SoAList& other) noexcept
+        {
+            std::swap(m_Columns, other.m_Columns);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_Capacity, other.m_Capacity);
+            std::swap(m_pAllocator, other.m_pAllocator);
+        }
+
+        //! \brief Append a record constructed from one argument per column.
+        //!
+        //! \param args - The values of the fields.
+        template<class... Args>
+        inline void Push(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == sizeof...(Ts), "Push requires a value for each column");
+
+            if (m_Size == m_Capacity)
+            {
+                // Construct the values before growing, the arguments may reference the records of this list.
+                std::tuple<Ts...> values(std::forward<Args>(args)...);
+                Grow(m_Size + 1);
+                std::apply(
+                    [this](auto&... values) {
+                        ConstructAt(m_Size, std::index_sequence_for<Ts...>{}, std::move(values)...);
+                    },
+                    values);
+            }
+            else
+            {
+                ConstructAt(m_Size, std::index_sequence_for<Ts...>{}, std::forward<Args>(args)...);
+            }
+
+            ++m_Size;
+        }
+
+        //! \brief Remove the last record.
+        inline void Pop()
+        {
+            UN_Assert(m_Size > 0, "List was empty");
+
+            --m_Size;
+            ForEachColumn([this](auto* pColumn) {
+                std::destroy_at(&pColumn[m_Size]);
+            });
+        }
+
+        //! \brief Remove a record by index and shift the records after it.
+        //!
+        //! \param index - The index of the record to remove.
+        inline void RemoveAt(USize index)
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+
+            ForEachColumn([this, index](auto* pColumn) {
+                std::move(pColumn + index + 1, pColumn + m_Size, pColumn + index);
+            });
+
+            Pop();
+        }
+
+        //! \brief Remove a record by index and replace it with the last record.
+        //!
+        //! This is faster than RemoveAt, but doesn't preserve the order of the records.
+        //!
+        //! \param index - The index of the record to remove.
+        inline void SwapRemoveAt(USize index)
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+
+            ForEachColumn([this, index](auto* pColumn) {
+                if (index != m_Size - 1)
+                {
+                    pColumn[index] = std::move(pColumn[m_Size - 1]);
+                }
+            });
+
+            Pop();
+        }
+
+        //! \brief Set the number of records, the new records are value-initialized.
+        //!
+        //! \param n - The new number of records.
+        inline void Resize(USize n)
+        {
+            if (n > m_Capacity)
+            {
+                Relocate(n, nullptr);
+            }
+
+            ForEachColumn([this, n](auto* pColumn) {
+                using T = std::remove_pointer_t<decltype(pColumn)>;
+                for (USize i = m_Size; i < n; ++i)
+                {
+                    new (&pColumn[i]) T();
+                }
+
+                if (n < m_Size)
+                {
+                    std::destroy(pColumn + n, pColumn + m_Size);
+                }
+            });
+
+            m_Size = n;
+        }
+
+        //! \brief Get the I-th column.
+        template<USize I>
+        [[nodiscard]] inline ArraySlice<ColumnType<I>> Column() noexcept
+        {
+            return ArraySlice<ColumnType<I>>(std::get<I>(m_Columns), m_Size);
+        }
+
+        //! \brief Get the I-th column.
+        template<USize I>
+        [[nodiscard]] inline ArraySlice<const ColumnType<I>> Column() const noexcept
+        {
+            return ArraySlice<const ColumnType<I>>(std::get<I>(m_Columns), m_Size);
+        }
+
+        //! \brief Get a field of a record.
+        //!
+        //! \tparam I - The index of the column.
+        //!
+        //! \param index - The index of the record.
+        template<USize I>
+        [[nodiscard]] inline ColumnType<I>& Get(USize index) noexcept
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            return std::get<I>(m_Columns)[index];
+        }
+
+        //! \brief Get a field of a record.
+        //!
+        //! \tparam I - The index of the column.
+        //!
+        //! \param index - The index of the record.
+        template<USize I>
+        [[nodiscard]] inline const ColumnType<I>& Get(USize index) const noexcept
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            return std::get<I>(m_Columns)[index];
+        }
+
+        //! \brief Get a tuple of references to all the fields of a record.
+        [[nodiscard]] inline std::tuple<Ts&...> operator[](USize index) noexcept
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            return GetRecord(index, std::index_sequence_for<Ts...>{});
+        }
+
+        //! \brief Get a tuple of references to all the fields of a record.
+        [[nodiscard]] inline std::tuple<const Ts&...> operator[](USize index) const noexcept
+        {
+            UN_Assert(index < m_Size, "Invalid index");
+            return GetRecord(index, std::index_sequence_for<Ts...>{});
+        }
+
+        //! \brief Sort the records using the I-th column as the sorting key.
+        //!
+        //! The records are sorted by computing the permutation on the key column first, then all the columns
+        //! are moved to the new storage in the sorted order. The sort is stable. Integer and enum keys are
+        //! sorted using radix sort.
+        //!
+        //! \tparam I - The index of the key column.
+        //!
+        //! \param descending - True if the records must be sorted in descending order.
+        template<USize I>
+        inline void SortByColumn(bool descending = false)
+        {
+            if (m_Size < 2)
+            {
+                return;
+            }
+
+            const ColumnType<I>* pKeys = std::get<I>(m_Columns);
+
+            List<USize> permutation(m_pAllocator);
+            permutation.Reserve(m_Size);
+            for (USize i = 0; i < m_Size; ++i)
+            {
+                permutation.Push(i);
+            }
+
+            if constexpr (Internal::IsRadixSortKey<ColumnType<I>>)
+            {
+                if (m_Size >= Internal::RadixSortThreshold)
+                {
+                    Internal::RadixSort(
+                        m_pAllocator,
+                        permutation.Data(),
+                        m_Size,
+                        [pKeys](USize i) {
+                            return pKeys[i];
+                        },
+                        descending);
+
+                    Relocate(m_Capacity, permutation.Data());
+                    return;
+                }
+            }
+
+            if (descending)
+            {
+                std::stable_sort(permutation.begin(), permutation.end(), [pKeys](USize lhs, USize rhs) {
+                    return pKeys[lhs] > pKeys[rhs];
+                });
+            }
+            else
+            {
+                std::stable_sort(permutation.begin(), permutation.end(), [pKeys](USize lhs, USize rhs) {
+                    return pKeys[lhs] < pKeys[rhs];
+                });
+            }
+
+            Relocate(m_Capacity, permutation.Data());
+        }
+    };
+
+    template<class... Ts>
+    struct IsTriviallyRelocatable<SoAList<Ts...>> : std::true_type
+    {
+    };
+} // namespace UN
@@ -0,0 +1,43 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Utils/BitUtils.h>
+#include <algorithm>
+#include <limits>
+
+namespace UN
+{
+    //! \brief A snapshot of allocation statistics of an allocator.
+    //!
+    //! The counters of allocations and deallocations only grow, so the allocation rate can be calculated
+    //! by taking two snapshots and dividing the difference by the time between them.
+    struct AllocatorStats
+    {
+        //! \brief The number of buckets in the size histogram.
+        inline static constexpr USize HistogramBucketCount = 32;
+
+        UInt64 AllocationCount     = 0; //!< Total number of allocations made.
+        UInt64 DeallocationCount   = 0; //!< Total number of deallocations made.
+        UInt64 TotalBytesAllocated = 0; //!< Total number of bytes allocated.
+        Int64 BytesInUse           = 0; //!< Number of bytes currently allocated.
+        Int64 PeakBytesInUse       = 0; //!< Maximum value of BytesInUse observed.
+
+        //! \brief The number of allocations by size.
+        //!
+        //! Bucket N counts allocations with size in range [2^N, 2^(N+1)), the last bucket also counts
+        //! all bigger allocations. Zero-sized allocations are counted in the first bucket.
+        UInt64 SizeHistogram[HistogramBucketCount]{};
+
+        //! \brief Number of allocations that are currently alive.
+        [[nodiscard]] inline Int64 LiveAllocationCount() const noexcept
+        {
+            return static_cast<Int64>(AllocationCount - DeallocationCount);
+        }
+
+        //! \brief Get index of the histogram bucket for the specified allocation size.
+        [[nodiscard]] inline static USize GetHistogramBucket(USize size) noexcept
+        {
+            auto size32 = static_cast<UInt32>(std::min<USize>(size, std::numeric_limits<UInt32>::max()));
+            return 31 ^ Bits::CountLeadingZeros(size32 | 1);
+        }
+    };
+} // namespace UN
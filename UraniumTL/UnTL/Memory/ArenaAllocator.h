@@ -0,0 +1,212 @@
+#pragma once
+#include <UnTL/Memory/IAllocator.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/RTTI/RTTI.h>
+
+namespace UN
+{
+    //! \brief A linear (bump-pointer) allocator that frees all of its allocations at once.
+    //!
+    //! The allocator carves allocations out of large chunks requested from a backing allocator.
+    //! Deallocate() does nothing, the memory is reclaimed all at once by Reset() or partially by Rewind().
+    //! The only exception is the sized Deallocate() of the most recent allocation: it moves the pointer back.
+    //! The most recent allocation can also be resized in place by TryExpandInPlace() or Reallocate().
+    //! The released chunks are kept for reuse until the arena is destroyed, so an arena that is reset
+    //! after each request stops calling the backing allocator once it has grown to the peak size.
+    //!
+    //! Example:
+    //! \code{.cpp}
+    //!     ArenaAllocator arena;
+    //!     auto marker = arena.GetMarker();
+    //!     HeapArray<int> scratch(&arena, 1024);
+    //!     // ...
+    //!     arena.Rewind(marker); // frees `scratch` and everything allocated after it.
+    //! \endcode
+    //!
+    //! \note The class is not thread-safe.
+    class ArenaAllocator final : public IAllocator
+    {
+        struct Chunk
+        {
+            Chunk* pPrev;
+            USize Size;
+        };
+
+        inline static constexpr USize ChunkHeaderSize = AlignUp<MaximumAlignment>(sizeof(Chunk));
+
+        IAllocator* m_pBackingAllocator;
+        USize m_ChunkSize;
+        Chunk* m_pChunk      = nullptr;
+        Chunk* m_pFreeChunks = nullptr;
+        UInt8* m_pCurrent    = nullptr;
+        UInt8* m_pEnd        = nullptr;
+
+        inline static UInt8* GetChunkData(Chunk* pChunk)
+        {
+            return reinterpret_cast<UInt8*>(pChunk) + ChunkHeaderSize;
+        }
+
+        inline void PushChunk(USize minSize);
+        inline void ReleaseChunk(Chunk* pChunk);
+
+    public:
+        UN_RTTI_Class(ArenaAllocator, "7E881340-480B-42B2-8E17-2E6E1B912212");
+
+        inline static constexpr USize DefaultChunkSize = 64 * 1024;
+
+        //! \brief A position in the arena that can be used to free all allocations made after it.
+        struct Marker
+        {
+            Chunk* pChunk;
+            UInt8* pCurrent;
+        };
+
+        //! \brief Create an arena allocator.
+        //!
+        //! \param chunkSize         - The size of chunks to request from the backing allocator.
+        //! \param pBackingAllocator - The allocator to request chunks from.
+        inline explicit ArenaAllocator(USize chunkSize = DefaultChunkSize, IAllocator* pBackingAllocator = SystemAllocator::Get())
+            : m_pBackingAllocator(pBackingAllocator)
+            , m_ChunkSize(chunkSize)
+        {
+        }
+
+        ArenaAllocator(const ArenaAllocator&)            = delete;
+        ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+        inline ~ArenaAllocator();
+
+        void* Allocate(USize size, USize alignment) override;
+        void Deallocate(void* pointer) override;
+        void Deallocate(void* pointer, USize size, USize alignment) override;
+        bool TryExpandInPlace(void* pointer, USize size, USize newSize, USize alignment) override;
+        [[nodiscard]] const char* GetName() const override;
+
+        //! \brief Get the current position in the arena.
+        [[nodiscard]] inline Marker GetMarker() const
+        {
+            return Marker{ m_pChunk, m_pCurrent };
+        }
+
+        //! \brief Free all allocations made after the marker was taken.
+        //!
+        //! \param marker - A marker previously returned by GetMarker() of this arena.
+        inline void Rewind(const Marker& marker);
+
+        //! \brief Free all allocations made by the arena.
+        inline void Reset()
+        {
+            Rewind(Marker{ nullptr, nullptr });
+        }
+    };
+
+    inline ArenaAllocator::~ArenaAllocator()
+    {
+        Reset();
+
+        Chunk* pChunk = m_pFreeChunks;
+        while (pChunk)
+        {
+            Chunk* pPrev = pChunk->pPrev;
+            m_pBackingAllocator->Deallocate(pChunk, ChunkHeaderSize + pChunk->Size, MaximumAlignment);
+            pChunk = pPrev;
+        }
+    }
+
+    inline void ArenaAllocator::PushChunk(USize minSize)
+    {
+        Chunk* pChunk = m_pFreeChunks;
+        if (pChunk && pChunk->Size >= minSize)
+        {
+            m_pFreeChunks = pChunk->pPrev;
+        }
+        else
+        {
+            USize size   = std::max(m_ChunkSize, minSize);
+            pChunk       = static_cast<Chunk*>(m_pBackingAllocator->Allocate(ChunkHeaderSize + size, MaximumAlignment));
+            pChunk->Size = size;
+        }
+
+        pChunk->pPrev = m_pChunk;
+        m_pChunk      = pChunk;
+        m_pCurrent    = GetChunkData(pChunk);
+        m_pEnd        = m_pCurrent + pChunk->Size;
+    }
+
+    inline void ArenaAllocator::ReleaseChunk(Chunk* pChunk)
+    {
+        if (pChunk->Size == m_ChunkSize)
+        {
+            pChunk->pPrev = m_pFreeChunks;
+            m_pFreeChunks = pChunk;
+        }
+        else
+        {
+            m_pBackingAllocator->Deallocate(pChunk, ChunkHeaderSize + pChunk->Size, MaximumAlignment);
+        }
+    }
+
+    inline void ArenaAllocator::Rewind(const Marker& marker)
+    {
+        while (m_pChunk != marker.pChunk)
+        {
+            UN_Assert(m_pChunk, "Invalid marker");
+            Chunk* pPrev = m_pChunk->pPrev;
+            ReleaseChunk(m_pChunk);
+            m_pChunk = pPrev;
+        }
+
+        if (m_pChunk)
+        {
+            m_pCurrent = marker.pCurrent;
+            m_pEnd     = GetChunkData(m_pChunk) + m_pChunk->Size;
+        }
+        else
+        {
+            m_pCurrent = nullptr;
+            m_pEnd     = nullptr;
+        }
+    }
+
+    inline void* ArenaAllocator::Allocate(USize size, USize alignment)
+    {
+        UInt8* pResult = AlignUpPtr(m_pCurrent, alignment);
+        if (m_pCurrent == nullptr || pResult + size > m_pEnd)
+        {
+            PushChunk(size + (alignment > MaximumAlignment ? alignment : 0));
+            pResult = AlignUpPtr(m_pCurrent, alignment);
+        }
+
+        m_pCurrent = pResult + size;
+        return pResult;
+    }
+
+    inline void ArenaAllocator::Deallocate(void*) {}
+
+    inline void ArenaAllocator::Deallocate(void* pointer, USize size, USize)
+    {
+        // The most recent allocation can be returned to the arena.
+        if (static_cast<UInt8*>(pointer) + size == m_pCurrent)
+        {
+            m_pCurrent = static_cast<UInt8*>(pointer);
+        }
+    }
+
+    inline bool ArenaAllocator::TryExpandInPlace(void* pointer, USize size, USize newSize, USize)
+    {
+        // Only the most recent allocation can be resized.
+        auto* pBegin = static_cast<UInt8*>(pointer);
+        if (pBegin + size != m_pCurrent || pBegin + newSize > m_pEnd)
+        {
+            return false;
+        }
+
+        m_pCurrent = pBegin + newSize;
+        return true;
+    }
+
+    inline const char* ArenaAllocator::GetName() const
+    {
+        return "Arena allocator";
+    }
+} // namespace UN
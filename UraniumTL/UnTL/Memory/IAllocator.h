@@ -1,6 +1,8 @@
 #pragma once
 #include <UnTL/RTTI/RTTI.h>
 #include <UnTL/Base/Base.h>
+#include <algorithm>
+#include <cstring>
 
 namespace UN
 {
@@ -23,6 +25,61 @@ namespace UN
         //! \param pointer - A pointer to the block of memory to deallocate.
         virtual void Deallocate(void* pointer) = 0;
 
+        //! \brief Deallocate memory of known size.
+        //!
+        //! Callers that know the size of the block should prefer this overload: allocators that serve blocks
+        //! from size classes can free the memory without storing or looking up the size. The default
+        //! implementation just calls Deallocate(void*).
+        //!
+        //! \param pointer   - A pointer to the block of memory to deallocate.
+        //! \param size      - Size of the block in bytes, must be the same as passed to Allocate().
+        //! \param alignment - Alignment of the block in bytes, must be the same as passed to Allocate().
+        inline virtual void Deallocate(void* pointer, [[maybe_unused]] USize size, [[maybe_unused]] USize alignment)
+        {
+            Deallocate(pointer);
+        }
+
+        //! \brief Try to resize a block of memory without moving it.
+        //!
+        //! The default implementation always fails.
+        //!
+        //! \param pointer   - A pointer to the block of memory to resize.
+        //! \param size      - Current size of the block in bytes.
+        //! \param newSize   - Requested size of the block in bytes.
+        //! \param alignment - Alignment of the block in bytes, must be the same as passed to Allocate().
+        //!
+        //! \return True if the block was resized, in which case it must be deallocated with the new size.
+        inline virtual bool TryExpandInPlace([[maybe_unused]] void* pointer, [[maybe_unused]] USize size,
+                                             [[maybe_unused]] USize newSize, [[maybe_unused]] USize alignment)
+        {
+            return false;
+        }
+
+        //! \brief Resize a block of memory, move it if it can't be resized in place.
+        //!
+        //! The contents of the block are moved with memcpy(), so this function must only be used to store
+        //! trivially copyable data. The default implementation tries TryExpandInPlace(), then allocates
+        //! a new block, copies the data and deallocates the old block.
+        //!
+        //! \param pointer   - A pointer to the block of memory to resize.
+        //! \param size      - Current size of the block in bytes.
+        //! \param newSize   - Requested size of the block in bytes.
+        //! \param alignment - Alignment of the block in bytes, must be the same as passed to Allocate().
+        //!
+        //! \return Pointer to the resized block of memory.
+        inline virtual void* Reallocate(void* pointer, USize size, USize newSize, USize alignment)
+        {
+            if (TryExpandInPlace(pointer, size, newSize, alignment))
+            {
+                return pointer;
+            }
+
+            void* result = Allocate(newSize, alignment);
+            memcpy(result, pointer, std::min(size, newSize));
+            Deallocate(pointer, size, alignment);
+            return result;
+        }
+
         //! \brief Get debug name of the allocator.
         [[nodiscard]] virtual const char* GetName() const = 0;
     };
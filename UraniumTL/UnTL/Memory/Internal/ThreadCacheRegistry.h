@@ -0,0 +1,381 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Memory/IAllocator.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace UN::Internal
+{
+    //! \brief A per-thread slot that caches a pointer to the thread cache of a single owner.
+    struct ThreadCacheSlot
+    {
+        UInt64 OwnerID = 0; //!< Unique ID of the owner, zero if the slot is empty.
+        void* pCache   = nullptr;
+    };
+
+    inline constexpr USize ThreadCacheSlotCount = 16;
+
+    //! \brief Get the table of thread cache slots of the calling thread.
+    inline ThreadCacheSlot* GetThreadCacheSlots() noexcept
+    {
+        thread_local ThreadCacheSlot slots[ThreadCacheSlotCount];
+        return slots;
+    }
+
+    //! \brief Allocate a new unique ID for a thread cache owner.
+    //!
+    //! The IDs are never reused, so a slot left behind by a destroyed owner can never match a new one.
+    inline UInt64 AllocateThreadCacheOwnerID() noexcept
+    {
+        static std::atomic<UInt64> nextID{ 1 };
+        return nextID.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    class ThreadCacheRegistryBase;
+
+    //! \brief The part of a thread cache node that links it to the list of caches of its thread.
+    struct ThreadCacheNodeBase
+    {
+        ThreadCacheRegistryBase* pRegistry  = nullptr;
+        ThreadCacheNodeBase** ppThreadHead  = nullptr; //!< Head of the list of the owning thread, null if not linked.
+        ThreadCacheNodeBase* pPrevInThread  = nullptr;
+        ThreadCacheNodeBase* pNextInThread  = nullptr;
+    };
+
+    //! \brief The list of thread caches created by a thread, used to release them when the thread exits.
+    struct ThreadCacheThreadState
+    {
+        ThreadCacheNodeBase* pHead = nullptr;
+        bool Exiting               = false;
+    };
+
+    //! \brief Get the mutex that guards the per-thread lists of thread caches of all registries.
+    inline std::mutex& GetThreadCacheMutex() noexcept
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    //! \brief Get the list of thread caches of the calling thread.
+    //!
+    //! The state is trivially destructible, so it can still be accessed from other thread_local destructors.
+    inline ThreadCacheThreadState& GetThreadCacheState() noexcept
+    {
+        thread_local ThreadCacheThreadState state;
+        return state;
+    }
+
+    //! \brief Base class of ThreadCacheRegistry that releases the caches of exiting threads.
+    class ThreadCacheRegistryBase
+    {
+        friend struct ThreadCacheExitHandler;
+
+    protected:
+        UInt64 m_OwnerID;
+
+        inline ThreadCacheRegistryBase() noexcept
+            : m_OwnerID(AllocateThreadCacheOwnerID())
+        {
+        }
+
+        ~ThreadCacheRegistryBase() = default;
+
+        //! \brief Release the cache of the exiting thread.
+        //!
+        //! Called with the thread cache mutex locked, the implementation can unlock it once it has locked the registry.
+        virtual void ReleaseExitingThread(ThreadCacheNodeBase* pNode, std::unique_lock<std::mutex>& globalLock) noexcept = 0;
+
+        //! \brief Link a node to the list of caches of the calling thread, so that it's released on thread exit.
+        inline static void LinkToThread(ThreadCacheNodeBase* pNode) noexcept;
+
+        //! \brief Unlink a node from the list of caches of its thread, the thread cache mutex must be locked.
+        inline static void UnlinkFromThread(ThreadCacheNodeBase* pNode) noexcept
+        {
+            if (pNode->ppThreadHead == nullptr)
+            {
+                return;
+            }
+
+            if (pNode->pPrevInThread)
+            {
+                pNode->pPrevInThread->pNextInThread = pNode->pNextInThread;
+            }
+            else
+            {
+                *pNode->ppThreadHead = pNode->pNextInThread;
+            }
+
+            if (pNode->pNextInThread)
+            {
+                pNode->pNextInThread->pPrevInThread = pNode->pPrevInThread;
+            }
+
+            pNode->ppThreadHead  = nullptr;
+            pNode->pPrevInThread = nullptr;
+            pNode->pNextInThread = nullptr;
+        }
+    };
+
+    //! \brief A thread_local object that releases the caches of the thread when it exits.
+    struct ThreadCacheExitHandler
+    {
+        inline ~ThreadCacheExitHandler()
+        {
+            ThreadCacheThreadState& state = GetThreadCacheState();
+            state.Exiting                 = true;
+
+            ThreadCacheSlot* slots = GetThreadCacheSlots();
+            while (true)
+            {
+                std::unique_lock lk(GetThreadCacheMutex());
+                ThreadCacheNodeBase* pNode = state.pHead;
+                if (pNode == nullptr)
+                {
+                    break;
+                }
+
+                // Releasing a cache can call back into another registry, e.g. to free arrays, so the slot of
+                // the released cache must be cleared first.
+                ThreadCacheRegistryBase* pRegistry = pNode->pRegistry;
+                for (USize i = 0; i < ThreadCacheSlotCount; ++i)
+                {
+                    if (slots[i].OwnerID == pRegistry->m_OwnerID)
+                    {
+                        slots[i] = {};
+                    }
+                }
+
+                ThreadCacheRegistryBase::UnlinkFromThread(pNode);
+                pRegistry->ReleaseExitingThread(pNode, lk);
+            }
+        }
+    };
+
+    inline void ThreadCacheRegistryBase::LinkToThread(ThreadCacheNodeBase* pNode) noexcept
+    {
+        ThreadCacheThreadState& state = GetThreadCacheState();
+        if (state.Exiting)
+        {
+            // The cache was created by a thread_local destructor, it stays in the registry until it's destroyed.
+            return;
+        }
+
+        thread_local ThreadCacheExitHandler exitHandler;
+        (void)exitHandler;
+
+        std::unique_lock lk(GetThreadCacheMutex());
+        if (pNode->ppThreadHead != nullptr)
+        {
+            return;
+        }
+
+        pNode->ppThreadHead  = &state.pHead;
+        pNode->pPrevInThread = nullptr;
+        pNode->pNextInThread = state.pHead;
+        if (state.pHead)
+        {
+            state.pHead->pPrevInThread = pNode;
+        }
+
+        state.pHead = pNode;
+    }
+
+    //! \brief A registry of per-thread caches owned by a single object, e.g. a pool or an allocator.
+    //!
+    //! Each thread that calls Get() receives its own instance of TCache. The lookup is lock-free in the common
+    //! case: the cache pointer is stored in a small thread-local table of ThreadCacheSlotCount slots. The home
+    //! slot of a registry is selected by its owner ID; if it's taken by another registry, the other slots are
+    //! probed before taking a lock. Only when more registries than slots are used by one thread at the same time,
+    //! they evict each other and Get() takes a lock more often.
+    //!
+    //! If a reclaim function is specified, the cache of a thread is passed to it and destroyed when the thread
+    //! exits, e.g. to return the cached memory to shared storage. Otherwise the caches of threads that have
+    //! already exited are kept until the registry is destroyed, so that the owner can still access them with ForEach.
+    //!
+    //! \tparam TCache - Type of per-thread cache.
+    template<class TCache>
+    class ThreadCacheRegistry final : public ThreadCacheRegistryBase
+    {
+    public:
+        //! \brief A function that takes the cache of an exiting thread, called with the registry locked.
+        using ReclaimFunc = void (*)(void* pOwner, TCache& cache);
+
+    private:
+        struct Node : ThreadCacheNodeBase
+        {
+            TCache Cache;
+            std::thread::id ThreadID;
+            Node* pNext;
+
+            template<class... Args>
+            inline explicit Node(std::thread::id threadID, Node* next, Args&&... args)
+                : Cache(std::forward<Args>(args)...)
+                , ThreadID(threadID)
+                , pNext(next)
+            {
+            }
+        };
+
+        IAllocator* m_pAllocator;
+        ReclaimFunc m_pfnReclaim;
+        void* m_pOwner;
+        Node* m_pHead = nullptr;
+        std::mutex m_Mutex;
+
+        inline void FreeNode(Node* node) noexcept
+        {
+            node->~Node();
+            m_pAllocator->Deallocate(node, sizeof(Node), alignof(Node));
+        }
+
+        template<class... Args>
+        inline TCache* GetSlow(ThreadCacheSlot* slots, Args&&... args)
+        {
+            for (USize i = 0; i < ThreadCacheSlotCount; ++i)
+            {
+                if (slots[i].OwnerID == m_OwnerID)
+                {
+                    return static_cast<TCache*>(slots[i].pCache);
+                }
+            }
+
+            auto threadID = std::this_thread::get_id();
+
+            std::unique_lock lk(m_Mutex);
+            Node* node = m_pHead;
+            while (node && node->ThreadID != threadID)
+            {
+                node = node->pNext;
+            }
+
+            if (node == nullptr)
+            {
+                void* pMemory   = m_pAllocator->Allocate(sizeof(Node), alignof(Node));
+                node            = new (pMemory) Node(threadID, m_pHead, std::forward<Args>(args)...);
+                node->pRegistry = this;
+                m_pHead         = node;
+            }
+
+            lk.unlock();
+
+            // The node can also be left by an exited thread with the same ID, link it to the current thread in any case.
+            LinkToThread(node);
+
+            const USize home      = m_OwnerID % ThreadCacheSlotCount;
+            ThreadCacheSlot* slot = &slots[home];
+            for (USize i = 0; i < ThreadCacheSlotCount; ++i)
+            {
+                ThreadCacheSlot& candidate = slots[(home + i) % ThreadCacheSlotCount];
+                if (candidate.OwnerID == 0)
+                {
+                    slot = &candidate;
+                    break;
+                }
+            }
+
+            slot->OwnerID = m_OwnerID;
+            slot->pCache  = &node->Cache;
+            return &node->Cache;
+        }
+
+        inline void ReleaseExitingThread(ThreadCacheNodeBase* pNode, std::unique_lock<std::mutex>& globalLock) noexcept override
+        {
+            if (m_pfnReclaim == nullptr)
+            {
+                return;
+            }
+
+            // Shutdown() locks the global mutex first, so the registry stays alive while this lock is held.
+            std::unique_lock lk(m_Mutex);
+            globalLock.unlock();
+
+            auto* node = static_cast<Node*>(pNode);
+            for (Node** ppNode = &m_pHead; *ppNode; ppNode = &(*ppNode)->pNext)
+            {
+                if (*ppNode == node)
+                {
+                    *ppNode = node->pNext;
+                    break;
+                }
+            }
+
+            m_pfnReclaim(m_pOwner, node->Cache);
+            FreeNode(node);
+        }
+
+    public:
+        //! \brief Create a registry.
+        //!
+        //! \param pAllocator - The allocator for the caches.
+        //! \param pfnReclaim - The function to pass the caches of exiting threads to, can be null.
+        //! \param pOwner     - The first argument of the reclaim function.
+        inline explicit ThreadCacheRegistry(IAllocator* pAllocator, ReclaimFunc pfnReclaim = nullptr, void* pOwner = nullptr)
+            : m_pAllocator(pAllocator)
+            , m_pfnReclaim(pfnReclaim)
+            , m_pOwner(pOwner)
+        {
+        }
+
+        ThreadCacheRegistry(const ThreadCacheRegistry&)            = delete;
+        ThreadCacheRegistry& operator=(const ThreadCacheRegistry&) = delete;
+
+        inline ~ThreadCacheRegistry()
+        {
+            Shutdown();
+
+            Node* node = m_pHead;
+            while (node)
+            {
+                Node* next = node->pNext;
+                FreeNode(node);
+                node = next;
+            }
+        }
+
+        //! \brief Stop releasing the caches on thread exit.
+        //!
+        //! Must be called by the owner before it destroys the state used by the reclaim function. After the call
+        //! the caches are only destroyed together with the registry.
+        inline void Shutdown() noexcept
+        {
+            std::unique_lock globalLock(GetThreadCacheMutex());
+            std::unique_lock lk(m_Mutex);
+            for (Node* node = m_pHead; node; node = node->pNext)
+            {
+                UnlinkFromThread(node);
+            }
+        }
+
+        //! \brief Get the cache of the calling thread, create one if it doesn't exist.
+        //!
+        //! \param args - Arguments to call the constructor of TCache with if the cache must be created.
+        //!
+        //! \return The cache that belongs to the calling thread.
+        template<class... Args>
+        UN_FINLINE TCache& Get(Args&&... args)
+        {
+            ThreadCacheSlot* slots = GetThreadCacheSlots();
+            ThreadCacheSlot& slot  = slots[m_OwnerID % ThreadCacheSlotCount];
+            if (slot.OwnerID == m_OwnerID)
+            {
+                return *static_cast<TCache*>(slot.pCache);
+            }
+
+            return *GetSlow(slots, std::forward<Args>(args)...);
+        }
+
+        //! \brief Invoke a function for each cache in the registry.
+        //!
+        //! \note This function must not be called concurrently with Get() from other threads.
+        template<class F>
+        inline void ForEach(F&& f)
+        {
+            std::unique_lock lk(m_Mutex);
+            for (Node* node = m_pHead; node; node = node->pNext)
+            {
+                f(node->Cache);
+            }
+        }
+    };
+} // namespace UN::Internal
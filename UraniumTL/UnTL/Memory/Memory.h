@@ -1,6 +1,7 @@
 #pragma once
 #include <UnTL/Memory/Ptr.h>
 #include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/Memory/WeakPtr.h>
 #include <UnTL/RTTI/RTTI.h>
 #include <unordered_map>
 
@@ -22,11 +23,11 @@ namespace UN
     template<class T, class TAllocator, class... Args>
     inline T* AllocateObjectEx(TAllocator* pAllocator, Args&&... args)
     {
-        USize counterSize = AlignUp(sizeof(ReferenceCounter), alignof(T));
-        USize wholeSize   = sizeof(T) + counterSize;
+        constexpr USize counterSize = ReferenceCounterOffset<T>;
+        constexpr USize wholeSize   = sizeof(T) + counterSize;
 
         auto* ptr     = static_cast<UInt8*>(pAllocator->Allocate(wholeSize, alignof(T)));
-        auto* counter = new (ptr) ReferenceCounter(pAllocator);
+        auto* counter = new (ptr) ReferenceCounter(pAllocator, wholeSize, alignof(T));
 
         T* object = new (ptr + counterSize) T(std::forward<Args>(args)...);
         object->AttachRefCounter(counter);
@@ -92,9 +93,9 @@ namespace UN
             return static_cast<value_type*>(m_Instance->Allocate(n * sizeof(T), alignof(T)));
         }
 
-        inline void deallocate(value_type* ptr, size_t) noexcept
+        inline void deallocate(value_type* ptr, size_t n) noexcept
         {
-            m_Instance->Deallocate(ptr);
+            m_Instance->Deallocate(ptr, n * sizeof(T), alignof(T));
         }
     };
 
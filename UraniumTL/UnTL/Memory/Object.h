@@ -67,6 +67,8 @@ namespace UN
     public:
         UN_RTTI_Class(Object<TInterface>, "5617B2CC-C963-45D5-8191-F14A06420954");
 
+        using ObjectBaseType = Object<TInterface>;
+
         Object() = default;
 
         virtual ~Object() = default;
@@ -103,4 +105,48 @@ namespace UN
             return m_RefCounter;
         }
     };
+
+    namespace Internal
+    {
+        //! Object<TInterface> declares two overloads of Release(), so the address of T::Release can only be
+        //! taken if T hides them with its own Release().
+        template<class T, class = void>
+        struct UsesObjectRelease : std::true_type
+        {
+        };
+
+        template<class T>
+        struct UsesObjectRelease<T, std::void_t<decltype(&T::Release)>> : std::false_type
+        {
+        };
+
+        //! \brief Check if the reference counter of T can be accessed directly, without virtual calls.
+        //!
+        //! This is true for final classes derived from Object<TInterface> that don't override AddRef() and
+        //! Release(): the pointer to such a class always points to the most derived object, and the counter
+        //! is located ReferenceCounterOffset<T> bytes before it.
+        template<class T, class = void>
+        struct HasInlineRefCount : std::false_type
+        {
+        };
+
+        template<class T>
+        struct HasInlineRefCount<T, std::void_t<typename T::ObjectBaseType>>
+            : std::bool_constant<std::is_final_v<T>
+                                 && std::is_same_v<decltype(&T::AddRef), UInt32 (T::ObjectBaseType::*)()>
+                                 && UsesObjectRelease<T>::value>
+        {
+        };
+
+        //! \brief Get the reference counter of an object allocated by AllocateObjectEx using the fixed layout.
+        template<class T>
+        UN_FINLINE ReferenceCounter* GetInlineRefCounter(T* pObject)
+        {
+            static_assert(HasInlineRefCount<T>::value);
+
+            auto* pCounter = reinterpret_cast<ReferenceCounter*>(reinterpret_cast<UInt8*>(pObject) - ReferenceCounterOffset<T>);
+            UN_Assert(pCounter == pObject->GetRefCounter(), "The object was not allocated by AllocateObjectEx");
+            return pCounter;
+        }
+    } // namespace Internal
 } // namespace UN
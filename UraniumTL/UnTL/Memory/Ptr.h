@@ -36,6 +36,9 @@ namespace UN
     //!
     //! See ReferenceCounter for more information.
     //!
+    //! If T is a final class derived from Object<TInterface>, the pointer updates the reference counter
+    //! directly, without calling the virtual AddRef() and Release().
+    //!
     //! \tparam T - Type of object to hold.
     //!
     //! \note T _must_ inherit from IObject.
@@ -76,7 +79,14 @@ namespace UN
         {
             if (m_pObject)
             {
-                m_pObject->AddRef();
+                if constexpr (Internal::HasInlineRefCount<T>::value)
+                {
+                    Internal::GetInlineRefCounter(m_pObject)->AddStrongRef();
+                }
+                else
+                {
+                    m_pObject->AddRef();
+                }
             }
         }
 
@@ -85,7 +95,18 @@ namespace UN
             UInt32 result = 0;
             if (m_pObject)
             {
-                result    = m_pObject->Release();
+                if constexpr (Internal::HasInlineRefCount<T>::value)
+                {
+                    T* pObject = m_pObject;
+                    result     = Internal::GetInlineRefCounter(pObject)->ReleaseStrongRef([pObject] {
+                        pObject->~T();
+                    });
+                }
+                else
+                {
+                    result = m_pObject->Release();
+                }
+
                 m_pObject = nullptr;
             }
 
@@ -269,6 +290,11 @@ namespace UN
         }
     };
 
+    template<class T>
+    struct IsTriviallyRelocatable<Ptr<T>> : std::true_type
+    {
+    };
+
     template<class T>
     inline bool operator==(const Ptr<T>& lhs, std::nullptr_t)
     {
@@ -2,6 +2,7 @@
 #include <UnTL/Base/Base.h>
 #include <UnTL/Memory/IAllocator.h>
 #include <UnTL/RTTI/RTTI.h>
+#include <limits>
 
 namespace UN
 {
@@ -14,12 +15,19 @@ namespace UN
     //! \code
     //!     +------------------+ <--- this pointer
     //!     | ReferenceCounter |
-    //!     --------------------
-    //!     |      Object      |
+    //!     |     padding      |
+    //!     +------------------+ <--- this pointer + ReferenceCounterOffset<T>
+    //!     |    Object (T)    |
     //!     +------------------+
     //! \endcode
     //!
-    //! It will delete `this` assuming that a single block was used to allocate the object and the counter.\n
+    //! The layout is fixed: AllocateObjectEx always places the object at ReferenceCounterOffset<T> bytes
+    //! after the counter. Ptr<T> relies on this when T is known to be the exact type of the object
+    //! to reach the counter without a virtual call (see Internal::HasInlineRefCount).
+    //!
+    //! It will delete `this` assuming that a single block was used to allocate the object and the counter.
+    //! The size and alignment of the block are stored in the counter and passed to the sized
+    //! IAllocator::Deallocate(), so that the allocator doesn't need to look them up.\n
     //!
     //! Example (pseudo-code):
     //! \code{.cpp}
@@ -38,10 +46,22 @@ namespace UN
     //!     Ptr<MyObject> pObj2 = pObj1;                      // refcount = 2 <-- Valid for std::shared_ptr too
     //!     Ptr<MyObject> pObj3 = pObj1.Get();                // refcount = 3 <-- Also valid here!
     //! \endcode
+    //!
+    //! The counter also holds the number of weak references (see WeakPtr). The object is destroyed when
+    //! the number of strong references reaches zero, but the memory is only freed when the number of weak
+    //! references reaches zero too. All the strong references together hold a single weak reference.
     class ReferenceCounter final
     {
         std::atomic<Int32> m_StrongRefCount;
+        UInt32 m_AllocationSize;
         mutable IAllocator* m_pAllocator;
+        UInt32 m_AllocationAlignment;
+        std::atomic<Int32> m_WeakRefCount;
+
+        inline void Deallocate()
+        {
+            m_pAllocator->Deallocate(this, m_AllocationSize, m_AllocationAlignment);
+        }
 
     public:
         UN_RTTI_Struct(ReferenceCounter, "CEDB61B5-D75B-4D08-BE6F-E1C11806989B");
@@ -51,11 +71,17 @@ namespace UN
         //! The specified allocator will be used to free memory after the counter reaches zero.
         //! This constructor initializes the counter to _zero_.
         //!
-        //! \param pAllocator - The allocator to use to free memory.
-        inline explicit ReferenceCounter(IAllocator* pAllocator)
+        //! \param pAllocator          - The allocator to use to free memory.
+        //! \param allocationSize      - The size of the whole block, including the counter.
+        //! \param allocationAlignment - The alignment the block was allocated with.
+        inline ReferenceCounter(IAllocator* pAllocator, USize allocationSize, USize allocationAlignment)
             : m_StrongRefCount(0)
+            , m_AllocationSize(static_cast<UInt32>(allocationSize))
             , m_pAllocator(pAllocator)
+            , m_AllocationAlignment(static_cast<UInt32>(allocationAlignment))
+            , m_WeakRefCount(1)
         {
+            UN_Assert(allocationSize <= std::numeric_limits<UInt32>::max(), "Object is too big");
         }
 
         //! \brief Add a strong reference to the counter.
@@ -66,9 +92,27 @@ namespace UN
             return ++m_StrongRefCount;
         }
 
+        //! \brief Add a strong reference to the counter if the object is still alive.
+        //!
+        //! \return True if the reference was added, false if the number of strong references is zero.
+        inline bool TryAddStrongRef()
+        {
+            Int32 refCount = m_StrongRefCount.load(std::memory_order_relaxed);
+            while (refCount != 0)
+            {
+                if (m_StrongRefCount.compare_exchange_weak(refCount, refCount + 1, std::memory_order_acq_rel,
+                                                           std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         //! \brief Remove a strong reference from the counter.
         //!
-        //! This function will delete the counter itself if number of references reaches zero.
+        //! This function will delete the counter itself if number of strong and weak references reaches zero.
         //!
         //! \param destroyCallback - A function to invoke _before_ deallocation if the counter reached zero.
         //!                          This is typically a lambda that calls object destructor.
@@ -78,11 +122,35 @@ namespace UN
         template<class F>
         inline UInt32 ReleaseStrongRef(F&& destroyCallback)
         {
-            UInt32 refCount = --m_StrongRefCount; 
+            UInt32 refCount = --m_StrongRefCount;
             if (refCount == 0)
             {
                 destroyCallback();
-                m_pAllocator->Deallocate(this);
+                ReleaseWeakRef();
+            }
+
+            return refCount;
+        }
+
+        //! \brief Add a weak reference to the counter.
+        //!
+        //! \return The new (incremented) number of weak references.
+        inline UInt32 AddWeakRef()
+        {
+            return m_WeakRefCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        //! \brief Remove a weak reference from the counter.
+        //!
+        //! This function will delete the counter itself if number of weak references reaches zero.
+        //!
+        //! \return The new (decremented) number of weak references.
+        inline UInt32 ReleaseWeakRef()
+        {
+            UInt32 refCount = m_WeakRefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+            if (refCount == 0)
+            {
+                Deallocate();
             }
 
             return refCount;
@@ -93,5 +161,17 @@ namespace UN
         {
             return m_StrongRefCount;
         }
+
+        //! \brief Get number of weak references, including the one held by the strong references.
+        inline UInt32 GetWeakRefCount() const
+        {
+            return m_WeakRefCount;
+        }
     };
+
+    static_assert(sizeof(ReferenceCounter) == 24);
+
+    //! \brief The offset of an object of type T from its ReferenceCounter in a block created by AllocateObjectEx.
+    template<class T>
+    inline constexpr USize ReferenceCounterOffset = AlignUp<alignof(T)>(sizeof(ReferenceCounter));
 } // namespace UN
@@ -0,0 +1,250 @@
+#include <UnTL/Memory/SlabAllocator.h>
+#include <algorithm>
+#include <array>
+
+namespace UN
+{
+    namespace
+    {
+        constexpr UInt32 SizeClassSizes[SlabAllocator::ClassCount] = { 8,   16,  32,  48,  64,  80,  96,  112,
+                                                                       128, 160, 192, 224, 256, 320, 384, 512 };
+
+        constexpr USize SizeClassGranularity = 8;
+
+        //! Maps (size + 7) / 8 to the index of the smallest size class that fits the size.
+        constexpr auto SizeClassLookup = [] {
+            std::array<UInt8, SlabAllocator::MaxSmallSize / SizeClassGranularity + 1> result{};
+            UInt8 sizeClass = 0;
+            for (USize i = 0; i < result.size(); ++i)
+            {
+                while (SizeClassSizes[sizeClass] < i * SizeClassGranularity)
+                {
+                    ++sizeClass;
+                }
+
+                result[i] = sizeClass;
+            }
+
+            return result;
+        }();
+
+        static_assert(SizeClassSizes[SlabAllocator::ClassCount - 1] == SlabAllocator::MaxSmallSize);
+    } // namespace
+
+    UInt32 SlabAllocator::GetSizeClassIndex(USize size)
+    {
+        return SizeClassLookup[(size + SizeClassGranularity - 1) / SizeClassGranularity];
+    }
+
+    USize SlabAllocator::GetSizeClassSize(UInt32 sizeClass)
+    {
+        return SizeClassSizes[sizeClass];
+    }
+
+    UInt32 SlabAllocator::GetBatchSize(UInt32 sizeClass)
+    {
+        // Move about 4KiB at once, but never less than 4 or more than 64 objects.
+        return std::clamp(static_cast<UInt32>(4096 / SizeClassSizes[sizeClass]), 4u, 64u);
+    }
+
+    SlabAllocator::SlabAllocator(IAllocator* pBackingAllocator)
+        : m_pBackingAllocator(pBackingAllocator)
+        , m_ThreadCaches(pBackingAllocator, &SlabAllocator::ReclaimThreadCache, this)
+    {
+    }
+
+    SlabAllocator::~SlabAllocator()
+    {
+        m_ThreadCaches.Shutdown();
+
+        SlabHeader* slab = m_pSlabs;
+        while (slab)
+        {
+            SlabHeader* next = slab->pNext;
+            m_pBackingAllocator->Deallocate(slab, SlabSize, SlabSize);
+            slab = next;
+        }
+    }
+
+    SlabAllocator::SlabHeader* SlabAllocator::AllocateSlab(UInt32 sizeClass)
+    {
+        auto* slab      = static_cast<SlabHeader*>(m_pBackingAllocator->Allocate(SlabSize, SlabSize));
+        slab->pOwner    = this;
+        slab->SizeClass = sizeClass;
+
+        std::unique_lock lk(m_SlabsMutex);
+        slab->pNext = m_pSlabs;
+        m_pSlabs    = slab;
+        return slab;
+    }
+
+    void SlabAllocator::Refill(ThreadCache::Bin& bin, UInt32 sizeClass)
+    {
+        SizeClass& sc    = m_SizeClasses[sizeClass];
+        USize objectSize = GetSizeClassSize(sizeClass);
+        UInt32 count     = GetBatchSize(sizeClass);
+
+        std::unique_lock lk(sc.Mutex);
+        for (UInt32 i = 0; i < count; ++i)
+        {
+            FreeObject* object = sc.pFreeList;
+            if (object)
+            {
+                sc.pFreeList = object->pNext;
+            }
+            else
+            {
+                if (sc.pCurrent + objectSize > sc.pEnd)
+                {
+                    auto* slab  = reinterpret_cast<UInt8*>(AllocateSlab(sizeClass));
+                    sc.pCurrent = slab + SlabHeaderSize;
+                    sc.pEnd     = slab + SlabSize;
+                }
+
+                object = reinterpret_cast<FreeObject*>(sc.pCurrent);
+                sc.pCurrent += objectSize;
+            }
+
+            object->pNext = bin.pHead;
+            bin.pHead     = object;
+            ++bin.Count;
+        }
+    }
+
+    void SlabAllocator::Flush(ThreadCache::Bin& bin, UInt32 sizeClass, UInt32 count)
+    {
+        FreeObject* first = bin.pHead;
+        FreeObject* last  = first;
+        for (UInt32 i = 1; i < count; ++i)
+        {
+            last = last->pNext;
+        }
+
+        bin.pHead = last->pNext;
+        bin.Count -= count;
+
+        SizeClass& sc = m_SizeClasses[sizeClass];
+        std::unique_lock lk(sc.Mutex);
+        last->pNext  = sc.pFreeList;
+        sc.pFreeList = first;
+    }
+
+    void SlabAllocator::ReclaimThreadCache(void* pOwner, ThreadCache& cache)
+    {
+        // Return the objects cached by an exiting thread to the shared free lists.
+        auto* allocator = static_cast<SlabAllocator*>(pOwner);
+        for (UInt32 sizeClass = 0; sizeClass < ClassCount; ++sizeClass)
+        {
+            ThreadCache::Bin& bin = cache.Bins[sizeClass];
+            if (bin.Count > 0)
+            {
+                allocator->Flush(bin, sizeClass, bin.Count);
+            }
+        }
+    }
+
+    void* SlabAllocator::AllocateLarge(USize size, USize alignment)
+    {
+        UN_Assert(alignment < SlabSize, "Alignment is too big");
+
+        // The object must start within the first SlabSize bytes of the block, so that Deallocate()
+        // can find the header by aligning the pointer down.
+        USize offset      = std::max(SlabHeaderSize, alignment);
+        auto* header      = static_cast<SlabHeader*>(m_pBackingAllocator->Allocate(offset + size, SlabSize));
+        header->pOwner    = this;
+        header->pNext     = nullptr;
+        header->SizeClass = LargeSizeClass;
+        return reinterpret_cast<UInt8*>(header) + offset;
+    }
+
+    void* SlabAllocator::Allocate(USize size, USize alignment)
+    {
+        // All size classes are multiples of MaximumAlignment except the first one,
+        // so a small over-aligned object just has to go to the next class.
+        USize effectiveSize = std::max(size, alignment);
+        if (effectiveSize > MaxSmallSize || alignment > MaximumAlignment)
+        {
+            return AllocateLarge(size, alignment);
+        }
+
+        UInt32 sizeClass      = GetSizeClassIndex(effectiveSize);
+        ThreadCache::Bin& bin = m_ThreadCaches.Get().Bins[sizeClass];
+        if (bin.pHead == nullptr)
+        {
+            Refill(bin, sizeClass);
+        }
+
+        FreeObject* object = bin.pHead;
+        bin.pHead          = object->pNext;
+        --bin.Count;
+        return object;
+    }
+
+    void SlabAllocator::DeallocateSmall(void* pointer, UInt32 sizeClass)
+    {
+        ThreadCache::Bin& bin = m_ThreadCaches.Get().Bins[sizeClass];
+        auto* object          = static_cast<FreeObject*>(pointer);
+        object->pNext         = bin.pHead;
+        bin.pHead             = object;
+
+        UInt32 batchSize = GetBatchSize(sizeClass);
+        if (++bin.Count > 2 * batchSize)
+        {
+            Flush(bin, sizeClass, batchSize);
+        }
+    }
+
+    void SlabAllocator::Deallocate(void* pointer)
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        auto* header = AlignDownPtr(static_cast<SlabHeader*>(pointer), SlabSize);
+        UN_Assert(header->pOwner == this, "The pointer was not allocated by this allocator");
+
+        UInt32 sizeClass = header->SizeClass;
+        if (sizeClass == LargeSizeClass)
+        {
+            m_pBackingAllocator->Deallocate(header);
+            return;
+        }
+
+        DeallocateSmall(pointer, sizeClass);
+    }
+
+    void SlabAllocator::Deallocate(void* pointer, USize size, USize alignment)
+    {
+        USize effectiveSize = std::max(size, alignment);
+        if (pointer == nullptr || effectiveSize > MaxSmallSize || alignment > MaximumAlignment)
+        {
+            Deallocate(pointer);
+            return;
+        }
+
+        // The size class is known from the size, the slab header doesn't need to be touched.
+        UInt32 sizeClass = GetSizeClassIndex(effectiveSize);
+        UN_Assert(AlignDownPtr(static_cast<SlabHeader*>(pointer), SlabSize)->SizeClass == sizeClass,
+                  "The size doesn't match the allocation");
+        DeallocateSmall(pointer, sizeClass);
+    }
+
+    bool SlabAllocator::TryExpandInPlace(void*, USize size, USize newSize, USize alignment)
+    {
+        // A block can grow or shrink within its size class.
+        USize effectiveSize    = std::max(size, alignment);
+        USize effectiveNewSize = std::max(newSize, alignment);
+        if (effectiveSize > MaxSmallSize || effectiveNewSize > MaxSmallSize || alignment > MaximumAlignment)
+        {
+            return false;
+        }
+
+        return GetSizeClassIndex(effectiveSize) == GetSizeClassIndex(effectiveNewSize);
+    }
+
+    const char* SlabAllocator::GetName() const
+    {
+        return "Slab allocator";
+    }
+} // namespace UN
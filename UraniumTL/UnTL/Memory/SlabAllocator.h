@@ -0,0 +1,109 @@
+#pragma once
+#include <UnTL/Memory/IAllocator.h>
+#include <UnTL/Memory/Internal/ThreadCacheRegistry.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/RTTI/RTTI.h>
+#include <mutex>
+
+namespace UN
+{
+    //! \brief An allocator for small objects that uses per-size-class free lists over fixed-size slabs.
+    //!
+    //! The allocator rounds small allocations up to one of the size classes and serves them from slabs:
+    //! SlabSize-aligned blocks requested from a backing allocator. Each thread has a cache of free objects
+    //! for each size class, so the common path of Allocate() and Deallocate() never takes a lock. The thread
+    //! caches are refilled from and flushed to the shared per-class free lists in batches.
+    //!
+    //! Each slab starts with a header that stores the size class, so Deallocate() finds the size class
+    //! of a pointer by aligning it down to SlabSize. The sized overload of Deallocate() computes the size
+    //! class from the size and doesn't access the header.
+    //!
+    //! Allocations that are larger than MaxSmallSize or require an alignment greater than MaximumAlignment
+    //! are forwarded to the backing allocator, they also get a SlabSize-aligned header, so the allocator
+    //! should mostly be used for small objects.
+    //!
+    //! The slabs are only returned to the backing allocator when the SlabAllocator is destroyed.
+    //!
+    //! \note The class is thread-safe.
+    class SlabAllocator final : public IAllocator
+    {
+    public:
+        inline static constexpr USize SlabSize     = 16 * 1024;
+        inline static constexpr USize MaxSmallSize = 512;
+        inline static constexpr USize ClassCount   = 16;
+
+    private:
+        inline static constexpr UInt32 LargeSizeClass = 0xFFFFFFFF;
+        inline static constexpr USize SlabHeaderSize  = CacheLineSize;
+
+        struct SlabHeader
+        {
+            SlabAllocator* pOwner;
+            SlabHeader* pNext;
+            UInt32 SizeClass;
+        };
+
+        static_assert(sizeof(SlabHeader) <= SlabHeaderSize);
+
+        struct FreeObject
+        {
+            FreeObject* pNext;
+        };
+
+        struct alignas(CacheLineSize) SizeClass
+        {
+            std::mutex Mutex;
+            FreeObject* pFreeList = nullptr;
+            UInt8* pCurrent       = nullptr;
+            UInt8* pEnd           = nullptr;
+        };
+
+        struct ThreadCache
+        {
+            struct Bin
+            {
+                FreeObject* pHead = nullptr;
+                UInt32 Count      = 0;
+            };
+
+            Bin Bins[ClassCount];
+        };
+
+        IAllocator* m_pBackingAllocator;
+        SizeClass m_SizeClasses[ClassCount];
+        Internal::ThreadCacheRegistry<ThreadCache> m_ThreadCaches;
+        std::mutex m_SlabsMutex;
+        SlabHeader* m_pSlabs = nullptr;
+
+        static UInt32 GetSizeClassIndex(USize size);
+        static USize GetSizeClassSize(UInt32 sizeClass);
+        static UInt32 GetBatchSize(UInt32 sizeClass);
+
+        SlabHeader* AllocateSlab(UInt32 sizeClass);
+        void Refill(ThreadCache::Bin& bin, UInt32 sizeClass);
+        void Flush(ThreadCache::Bin& bin, UInt32 sizeClass, UInt32 count);
+        static void ReclaimThreadCache(void* pOwner, ThreadCache& cache);
+
+        void* AllocateLarge(USize size, USize alignment);
+        void DeallocateSmall(void* pointer, UInt32 sizeClass);
+
+    public:
+        UN_RTTI_Class(SlabAllocator, "9E56F844-8E6C-4390-A07F-FA1CED181C2D");
+
+        //! \brief Create a slab allocator.
+        //!
+        //! \param pBackingAllocator - The allocator to request slabs and large blocks from.
+        explicit SlabAllocator(IAllocator* pBackingAllocator = SystemAllocator::Get());
+
+        SlabAllocator(const SlabAllocator&)            = delete;
+        SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+        ~SlabAllocator();
+
+        void* Allocate(USize size, USize alignment) override;
+        void Deallocate(void* pointer) override;
+        void Deallocate(void* pointer, USize size, USize alignment) override;
+        bool TryExpandInPlace(void* pointer, USize size, USize newSize, USize alignment) override;
+        [[nodiscard]] const char* GetName() const override;
+    };
+} // namespace UN
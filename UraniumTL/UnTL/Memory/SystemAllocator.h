@@ -15,8 +15,11 @@ namespace UN
     public:
         UN_RTTI_Class(SystemAllocator, "6C2B53D6-3A9A-447F-A127-1052253189C4");
 
+        using IAllocator::Deallocate;
+
         void* Allocate(USize size, USize alignment) override;
         void Deallocate(void* pointer) override;
+        void* Reallocate(void* pointer, USize size, USize newSize, USize alignment) override;
         [[nodiscard]] const char* GetName() const override;
 
         [[nodiscard]] Int64 AllocationCount() const;
@@ -42,6 +45,18 @@ namespace UN
         return UN_AlignedFree(pointer);
     }
 
+    inline void* SystemAllocator::Reallocate(void* pointer, USize size, USize newSize, USize alignment)
+    {
+#ifdef UN_AlignedReallocMaxAlignment
+        if (alignment > UN_AlignedReallocMaxAlignment)
+        {
+            return IAllocator::Reallocate(pointer, size, newSize, alignment);
+        }
+#endif
+
+        return UN_AlignedRealloc(pointer, newSize, alignment);
+    }
+
     inline const char* SystemAllocator::GetName() const
     {
         return "System allocator";
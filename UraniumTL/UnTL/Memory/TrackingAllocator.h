@@ -0,0 +1,258 @@
+#pragma once
+#include <UnTL/Memory/AllocatorStats.h>
+#include <UnTL/Memory/IAllocator.h>
+#include <UnTL/Memory/Internal/ThreadCacheRegistry.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/RTTI/RTTI.h>
+#include <mutex>
+
+namespace UN
+{
+    //! \brief Information about an allocation that is alive, reported by TrackingAllocator in call site tracking mode.
+    struct LiveAllocationInfo
+    {
+        void* pPointer;  //!< The pointer returned by Allocate().
+        USize Size;      //!< The size passed to Allocate().
+        void* pCallSite; //!< The return address of the Allocate() call.
+    };
+
+    //! \brief An allocator that collects statistics of allocations and forwards them to another allocator.
+    //!
+    //! Each allocation gets a small header that stores its size, so that the allocator can update
+    //! the statistics in Deallocate(). The counters are sharded per thread: the hot path only updates
+    //! the counters of the calling thread without atomic read-modify-write operations. The number of bytes
+    //! in use is flushed to a global counter once the thread has allocated or freed FlushThreshold bytes,
+    //! so PeakBytesInUse is precise up to FlushThreshold bytes per thread.
+    //!
+    //! In call site tracking mode the allocator also records the return address of each Allocate() call
+    //! and keeps all live allocations in a list protected by a mutex. This is slow, but makes it possible
+    //! to find the code that leaked memory with ForEachLiveAllocation().
+    //!
+    //! Example:
+    //! \code{.cpp}
+    //!     TrackingAllocator tracking(SystemAllocator::Get(), true);
+    //!     // ... use the allocator ...
+    //!     tracking.ForEachLiveAllocation([](const LiveAllocationInfo& info) {
+    //!         printf("%zu bytes leaked at %p\n", info.Size, info.pCallSite);
+    //!     });
+    //! \endcode
+    class TrackingAllocator final : public IAllocator
+    {
+    public:
+        inline static constexpr Int64 FlushThreshold = 64 * 1024;
+
+    private:
+        struct Header
+        {
+            Header* pPrev;
+            Header* pNext;
+            void* pCallSite;
+            USize Size;
+            UInt32 Offset;
+            UInt32 BlockAlignment;
+        };
+
+        inline static constexpr USize HeaderSize = AlignUp<MaximumAlignment>(sizeof(Header));
+
+        struct alignas(CacheLineSize) Shard
+        {
+            std::atomic<UInt64> AllocationCount{};
+            std::atomic<UInt64> DeallocationCount{};
+            std::atomic<UInt64> TotalBytesAllocated{};
+            std::atomic<Int64> BytesInUse{};
+            std::atomic<UInt64> SizeHistogram[AllocatorStats::HistogramBucketCount]{};
+            Int64 PendingBytes = 0;
+        };
+
+        IAllocator* m_pAllocator;
+        bool m_TrackCallSites;
+        Internal::ThreadCacheRegistry<Shard> m_Shards;
+        std::atomic<Int64> m_FlushedBytes{};
+        std::atomic<Int64> m_PeakBytes{};
+        std::mutex m_Mutex;
+        Header* m_pLiveHead = nullptr;
+
+        //! Only the owning thread writes to a shard, so a plain load and store are enough.
+        template<class T>
+        UN_FINLINE static void Add(std::atomic<T>& counter, T value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        inline static Header* GetHeader(void* pointer)
+        {
+            return reinterpret_cast<Header*>(static_cast<UInt8*>(pointer) - sizeof(Header));
+        }
+
+        inline void UpdateBytesInUse(Shard& shard, Int64 delta);
+        inline void* AllocateImpl(USize size, USize alignment, void* pCallSite);
+
+    public:
+        UN_RTTI_Class(TrackingAllocator, "4713ADCD-A66E-47E8-B1D1-2FACE555F6E9");
+
+        //! \brief Create a tracking allocator.
+        //!
+        //! \param pAllocator     - The allocator to forward the allocations to.
+        //! \param trackCallSites - True if the call sites of live allocations must be recorded.
+        inline explicit TrackingAllocator(IAllocator* pAllocator = SystemAllocator::Get(), bool trackCallSites = false)
+            : m_pAllocator(pAllocator)
+            , m_TrackCallSites(trackCallSites)
+            , m_Shards(pAllocator)
+        {
+        }
+
+        TrackingAllocator(const TrackingAllocator&)            = delete;
+        TrackingAllocator& operator=(const TrackingAllocator&) = delete;
+
+        using IAllocator::Deallocate;
+
+        void* Allocate(USize size, USize alignment) override;
+        void Deallocate(void* pointer) override;
+        [[nodiscard]] const char* GetName() const override;
+
+        //! \brief Get the allocator the allocations are forwarded to.
+        [[nodiscard]] inline IAllocator* GetInnerAllocator() const noexcept
+        {
+            return m_pAllocator;
+        }
+
+        //! \brief Collect statistics from all threads.
+        //!
+        //! The counters of different threads are read independently, so the result can be slightly
+        //! inconsistent if the allocator is used concurrently.
+        [[nodiscard]] inline AllocatorStats GetStats();
+
+        //! \brief Invoke a function for each live allocation.
+        //!
+        //! This function does nothing if the allocator was created without call site tracking.
+        //!
+        //! \param f - The function to invoke with a `const LiveAllocationInfo&`.
+        template<class F>
+        inline void ForEachLiveAllocation(F&& f)
+        {
+            std::unique_lock lk(m_Mutex);
+            for (Header* pHeader = m_pLiveHead; pHeader; pHeader = pHeader->pNext)
+            {
+                auto* pointer = reinterpret_cast<UInt8*>(pHeader) + sizeof(Header);
+                f(LiveAllocationInfo{ pointer, pHeader->Size, pHeader->pCallSite });
+            }
+        }
+    };
+
+    inline void TrackingAllocator::UpdateBytesInUse(Shard& shard, Int64 delta)
+    {
+        Add(shard.BytesInUse, delta);
+
+        shard.PendingBytes += delta;
+        if (shard.PendingBytes < FlushThreshold && shard.PendingBytes > -FlushThreshold)
+        {
+            return;
+        }
+
+        Int64 bytes = m_FlushedBytes.fetch_add(shard.PendingBytes, std::memory_order_relaxed) + shard.PendingBytes;
+        shard.PendingBytes = 0;
+
+        Int64 peak = m_PeakBytes.load(std::memory_order_relaxed);
+        while (bytes > peak && !m_PeakBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    inline void* TrackingAllocator::AllocateImpl(USize size, USize alignment, void* pCallSite)
+    {
+        USize offset         = AlignUp(HeaderSize, alignment);
+        USize blockAlignment = std::max(MaximumAlignment, alignment);
+        auto* pBlock         = static_cast<UInt8*>(m_pAllocator->Allocate(offset + size, blockAlignment));
+        auto* result         = pBlock + offset;
+
+        Header* pHeader         = GetHeader(result);
+        pHeader->pPrev          = nullptr;
+        pHeader->pNext          = nullptr;
+        pHeader->pCallSite      = pCallSite;
+        pHeader->Size           = size;
+        pHeader->Offset         = static_cast<UInt32>(offset);
+        pHeader->BlockAlignment = static_cast<UInt32>(blockAlignment);
+
+        Shard& shard = m_Shards.Get();
+        Add(shard.AllocationCount, UInt64{ 1 });
+        Add(shard.TotalBytesAllocated, static_cast<UInt64>(size));
+        Add(shard.SizeHistogram[AllocatorStats::GetHistogramBucket(size)], UInt64{ 1 });
+        UpdateBytesInUse(shard, static_cast<Int64>(size));
+
+        if (m_TrackCallSites)
+        {
+            std::unique_lock lk(m_Mutex);
+            pHeader->pNext = m_pLiveHead;
+            if (m_pLiveHead)
+            {
+                m_pLiveHead->pPrev = pHeader;
+            }
+
+            m_pLiveHead = pHeader;
+        }
+
+        return result;
+    }
+
+    inline void* TrackingAllocator::Allocate(USize size, USize alignment)
+    {
+        return AllocateImpl(size, alignment, m_TrackCallSites ? UN_ReturnAddress() : nullptr);
+    }
+
+    inline void TrackingAllocator::Deallocate(void* pointer)
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        Header* pHeader = GetHeader(pointer);
+        if (m_TrackCallSites)
+        {
+            std::unique_lock lk(m_Mutex);
+            if (pHeader->pPrev)
+            {
+                pHeader->pPrev->pNext = pHeader->pNext;
+            }
+            else
+            {
+                m_pLiveHead = pHeader->pNext;
+            }
+
+            if (pHeader->pNext)
+            {
+                pHeader->pNext->pPrev = pHeader->pPrev;
+            }
+        }
+
+        Shard& shard = m_Shards.Get();
+        Add(shard.DeallocationCount, UInt64{ 1 });
+        UpdateBytesInUse(shard, -static_cast<Int64>(pHeader->Size));
+
+        USize offset = pHeader->Offset;
+        m_pAllocator->Deallocate(static_cast<UInt8*>(pointer) - offset, offset + pHeader->Size, pHeader->BlockAlignment);
+    }
+
+    inline const char* TrackingAllocator::GetName() const
+    {
+        return "Tracking allocator";
+    }
+
+    inline AllocatorStats TrackingAllocator::GetStats()
+    {
+        AllocatorStats stats;
+        m_Shards.ForEach([&stats](const Shard& shard) {
+            stats.AllocationCount += shard.AllocationCount.load(std::memory_order_relaxed);
+            stats.DeallocationCount += shard.DeallocationCount.load(std::memory_order_relaxed);
+            stats.TotalBytesAllocated += shard.TotalBytesAllocated.load(std::memory_order_relaxed);
+            stats.BytesInUse += shard.BytesInUse.load(std::memory_order_relaxed);
+            for (USize i = 0; i < AllocatorStats::HistogramBucketCount; ++i)
+            {
+                stats.SizeHistogram[i] += shard.SizeHistogram[i].load(std::memory_order_relaxed);
+            }
+        });
+
+        stats.PeakBytesInUse = std::max(stats.BytesInUse, m_PeakBytes.load(std::memory_order_relaxed));
+        return stats;
+    }
+} // namespace UN
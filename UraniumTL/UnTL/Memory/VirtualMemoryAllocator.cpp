@@ -0,0 +1,240 @@
+#include <UnTL/Memory/VirtualMemoryAllocator.h>
+
+#if UN_WINDOWS
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <Windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace UN
+{
+    USize VirtualMemoryAllocator::GetPageSize()
+    {
+#if UN_WINDOWS
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+#else
+        static const USize pageSize = static_cast<USize>(sysconf(_SC_PAGESIZE));
+        return pageSize;
+#endif
+    }
+
+    VirtualMemoryAllocator::VirtualMemoryAllocator(bool useHugePages, USize maxCachedMappings)
+        : m_UseHugePages(useHugePages)
+        , m_MaxCachedMappings(std::min(maxCachedMappings, MaxCachedMappingCount))
+    {
+#if UN_WINDOWS
+        m_UseHugePages = false;
+#endif
+        m_Granularity = m_UseHugePages ? HugePageSize : GetPageSize();
+    }
+
+    VirtualMemoryAllocator::~VirtualMemoryAllocator()
+    {
+        for (USize i = 0; i < m_CachedMappingCount; ++i)
+        {
+            Unmap(m_CachedMappings[i].pBase, m_CachedMappings[i].Size);
+        }
+    }
+
+    void* VirtualMemoryAllocator::Map(USize size, USize alignment)
+    {
+#if UN_WINDOWS
+        void* pBase = nullptr;
+        if (alignment <= GetPageSize())
+        {
+            pBase = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        }
+
+        // A reservation can't be trimmed: find an aligned address in a larger range, release it and map
+        // exactly there. Another thread can take the address in between, so try again if that happens.
+        while (pBase == nullptr)
+        {
+            void* pReserved = VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+            UN_Assert(pReserved, "VirtualAlloc failed");
+            VirtualFree(pReserved, 0, MEM_RELEASE);
+
+            auto* pAligned = AlignUpPtr(static_cast<UInt8*>(pReserved), alignment);
+            pBase          = VirtualAlloc(pAligned, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        }
+#else
+        // Over-reserve to align the mapping, then trim the extra space.
+        USize reserveSize = alignment > GetPageSize() ? size + alignment : size;
+        void* pReserved =
+            mmap(nullptr, reserveSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        UN_Assert(pReserved != MAP_FAILED, "mmap failed");
+
+        void* pBase = pReserved;
+        if (reserveSize != size)
+        {
+            auto* pAligned = AlignUpPtr(static_cast<UInt8*>(pReserved), alignment);
+            USize headSize = pAligned - static_cast<UInt8*>(pReserved);
+            USize tailSize = reserveSize - headSize - size;
+            if (headSize)
+            {
+                munmap(pReserved, headSize);
+            }
+            if (tailSize)
+            {
+                munmap(pAligned + size, tailSize);
+            }
+
+            pBase = pAligned;
+        }
+
+        if (m_UseHugePages)
+        {
+            madvise(pBase, size, MADV_HUGEPAGE);
+        }
+#endif
+
+        m_MappedBytes.fetch_add(size, std::memory_order_relaxed);
+        return pBase;
+    }
+
+    void VirtualMemoryAllocator::Unmap(void* pBase, USize size)
+    {
+#if UN_WINDOWS
+        VirtualFree(pBase, 0, MEM_RELEASE);
+#else
+        munmap(pBase, size);
+#endif
+        m_MappedBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void VirtualMemoryAllocator::Commit([[maybe_unused]] void* pBase, [[maybe_unused]] USize size)
+    {
+#if UN_WINDOWS
+        VirtualAlloc(pBase, size, MEM_COMMIT, PAGE_READWRITE);
+#endif
+        // On Linux the pages released by MADV_DONTNEED are committed again on the first access.
+    }
+
+    void VirtualMemoryAllocator::Decommit(void* pBase, USize size)
+    {
+#if UN_WINDOWS
+        VirtualFree(pBase, size, MEM_DECOMMIT);
+#else
+        madvise(pBase, size, MADV_DONTNEED);
+#endif
+    }
+
+    void* VirtualMemoryAllocator::TakeCachedMapping(USize size, USize alignment)
+    {
+        CachedMapping mapping;
+        {
+            std::unique_lock lk(m_Mutex);
+
+            // Find the smallest cached mapping that fits, but don't waste more than a half of it.
+            // On Windows a reservation can't be trimmed, so the size must match exactly.
+            SSize bestIndex = -1;
+            for (USize i = 0; i < m_CachedMappingCount; ++i)
+            {
+                const CachedMapping& cached = m_CachedMappings[i];
+#if UN_WINDOWS
+                const bool fits = cached.Size == size;
+#else
+                const bool fits = cached.Size >= size && cached.Size <= size * 2;
+#endif
+                if (fits && reinterpret_cast<USize>(cached.pBase) % alignment == 0
+                    && (bestIndex == -1 || cached.Size < m_CachedMappings[bestIndex].Size))
+                {
+                    bestIndex = static_cast<SSize>(i);
+                }
+            }
+
+            if (bestIndex == -1)
+            {
+                return nullptr;
+            }
+
+            mapping                     = m_CachedMappings[bestIndex];
+            m_CachedMappings[bestIndex] = m_CachedMappings[--m_CachedMappingCount];
+        }
+
+        // The size of a live mapping must be computable from the allocation size, so unmap the unused tail.
+        if (mapping.Size > size)
+        {
+            Unmap(static_cast<UInt8*>(mapping.pBase) + size, mapping.Size - size);
+        }
+
+        return mapping.pBase;
+    }
+
+    void* VirtualMemoryAllocator::Allocate(USize size, USize alignment)
+    {
+        // The data starts right at the mapping base, so the base must have the requested alignment.
+        USize mappingSize      = GetMappingSize(size);
+        USize mappingAlignment = std::max(alignment, m_Granularity);
+
+        void* pBase = TakeCachedMapping(mappingSize, mappingAlignment);
+        if (pBase)
+        {
+            Commit(pBase, mappingSize);
+        }
+        else
+        {
+            pBase = Map(mappingSize, mappingAlignment);
+        }
+
+        std::unique_lock lk(m_Mutex);
+        m_LiveMappings.TryEmplace(pBase, mappingSize);
+        return pBase;
+    }
+
+    void VirtualMemoryAllocator::Release(void* pBase, USize mappingSize)
+    {
+        bool canCache;
+        {
+            std::unique_lock lk(m_Mutex);
+            auto it = m_LiveMappings.Find(pBase);
+            UN_Assert(it != m_LiveMappings.end(), "The pointer was not allocated by this allocator");
+            UN_Assert(mappingSize == 0 || it->second == mappingSize, "Incorrect allocation size");
+
+            mappingSize = it->second;
+            m_LiveMappings.Remove(it);
+            canCache = m_CachedMappingCount < m_MaxCachedMappings;
+        }
+
+        // Don't decommit a mapping that is about to be unmapped anyway.
+        if (canCache)
+        {
+            // Decommit before the mapping is published, another thread can take it right after that.
+            Decommit(pBase, mappingSize);
+
+            std::unique_lock lk(m_Mutex);
+            if (m_CachedMappingCount < m_MaxCachedMappings)
+            {
+                m_CachedMappings[m_CachedMappingCount++] = CachedMapping{ pBase, mappingSize };
+                return;
+            }
+        }
+
+        Unmap(pBase, mappingSize);
+    }
+
+    void VirtualMemoryAllocator::Deallocate(void* pointer)
+    {
+        if (pointer)
+        {
+            Release(pointer, 0);
+        }
+    }
+
+    void VirtualMemoryAllocator::Deallocate(void* pointer, USize size, [[maybe_unused]] USize alignment)
+    {
+        if (pointer)
+        {
+            Release(pointer, GetMappingSize(size));
+        }
+    }
+
+    const char* VirtualMemoryAllocator::GetName() const
+    {
+        return "Virtual memory allocator";
+    }
+} // namespace UN
@@ -0,0 +1,96 @@
+#pragma once
+#include <UnTL/Containers/HashMap.h>
+#include <UnTL/Memory/IAllocator.h>
+#include <UnTL/RTTI/RTTI.h>
+#include <mutex>
+
+namespace UN
+{
+    //! \brief An allocator that maps each allocation directly from the OS virtual memory.
+    //!
+    //! The allocator is intended for large blocks (hundreds of kilobytes and more): every allocation takes
+    //! at least one page and a system call. The memory is reserved and committed lazily: the OS backs
+    //! the pages with physical memory when they are touched for the first time.
+    //!
+    //! The returned pointer is the start of the mapping, there's no header in front of the data. The size
+    //! of the mapping is computed from the size passed to the sized Deallocate(). The sizes of live mappings
+    //! are also kept in a side table, so that the unsized Deallocate() works too.
+    //!
+    //! Deallocated mappings are not unmapped immediately. They are decommitted (MADV_DONTNEED on Linux,
+    //! MEM_DECOMMIT on Windows) and kept in a small cache, so that the next allocation of a similar size
+    //! can reuse the address range without creating a new mapping.
+    //!
+    //! If huge pages are enabled, the mappings are aligned to HugePageSize and marked with MADV_HUGEPAGE
+    //! so that the kernel can back them with transparent huge pages, which reduces TLB pressure for large
+    //! buffers. Huge pages are only supported on Linux, the option is ignored on other platforms.
+    //!
+    //! \note The class is thread-safe.
+    class VirtualMemoryAllocator final : public IAllocator
+    {
+    public:
+        inline static constexpr USize HugePageSize             = 2 * 1024 * 1024;
+        inline static constexpr USize DefaultMaxCachedMappings = 16;
+
+    private:
+        struct CachedMapping
+        {
+            void* pBase;
+            USize Size;
+        };
+
+        inline static constexpr USize MaxCachedMappingCount = 64;
+
+        bool m_UseHugePages;
+        USize m_Granularity;
+        USize m_MaxCachedMappings;
+
+        std::mutex m_Mutex;
+        CachedMapping m_CachedMappings[MaxCachedMappingCount]{};
+        USize m_CachedMappingCount = 0;
+        HashMap<void*, USize> m_LiveMappings;
+        std::atomic<USize> m_MappedBytes{};
+
+        void* Map(USize size, USize alignment);
+        void Unmap(void* pBase, USize size);
+        void Commit(void* pBase, USize size);
+        void Decommit(void* pBase, USize size);
+
+        [[nodiscard]] inline USize GetMappingSize(USize size) const noexcept
+        {
+            return AlignUp(std::max(size, USize{ 1 }), m_Granularity);
+        }
+
+        void* TakeCachedMapping(USize size, USize alignment);
+        void Release(void* pBase, USize mappingSize);
+
+    public:
+        UN_RTTI_Class(VirtualMemoryAllocator, "099C093A-39C5-48C1-88BD-2911654B1B31");
+
+        //! \brief Create a virtual memory allocator.
+        //!
+        //! \param useHugePages      - True if the mappings must be eligible for transparent huge pages.
+        //! \param maxCachedMappings - The maximum number of freed mappings to keep for reuse.
+        explicit VirtualMemoryAllocator(bool useHugePages = false, USize maxCachedMappings = DefaultMaxCachedMappings);
+
+        VirtualMemoryAllocator(const VirtualMemoryAllocator&)            = delete;
+        VirtualMemoryAllocator& operator=(const VirtualMemoryAllocator&) = delete;
+
+        ~VirtualMemoryAllocator();
+
+        using IAllocator::Deallocate;
+
+        void* Allocate(USize size, USize alignment) override;
+        void Deallocate(void* pointer) override;
+        void Deallocate(void* pointer, USize size, USize alignment) override;
+        [[nodiscard]] const char* GetName() const override;
+
+        //! \brief Get the number of bytes of address space currently mapped, including the cached mappings.
+        [[nodiscard]] inline USize GetMappedBytes() const noexcept
+        {
+            return m_MappedBytes.load(std::memory_order_relaxed);
+        }
+
+        //! \brief Get the OS page size.
+        [[nodiscard]] static USize GetPageSize();
+    };
+} // namespace UN
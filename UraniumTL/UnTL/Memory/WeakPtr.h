@@ -0,0 +1,169 @@
+#pragma once
+#include <UnTL/Memory/Ptr.h>
+
+namespace UN
+{
+    //! \brief A non-owning reference to an object that is managed by Ptr.
+    //!
+    //! A weak pointer doesn't keep the object alive, but keeps its memory (and the ReferenceCounter)
+    //! allocated, so it can check if the object is still alive and get a strong reference to it.
+    //!
+    //! Example:
+    //! \code{.cpp}
+    //!     Ptr<MyObject> pObj     = AllocateObject<MyObject>();
+    //!     WeakPtr<MyObject> weak = pObj;
+    //!     if (Ptr<MyObject> locked = weak.TryLock())
+    //!     {
+    //!         // the object is alive
+    //!     }
+    //! \endcode
+    //!
+    //! \tparam T - Type of object to hold.
+    //!
+    //! \see ReferenceCounter
+    template<class T>
+    class WeakPtr final
+    {
+        T* m_pObject                 = nullptr;
+        ReferenceCounter* m_pCounter = nullptr;
+
+        template<class T1>
+        friend class WeakPtr;
+
+        inline static ReferenceCounter* GetRefCounter(T* pObject)
+        {
+            if constexpr (Internal::HasInlineRefCount<T>::value)
+            {
+                return Internal::GetInlineRefCounter(pObject);
+            }
+            else
+            {
+                return pObject->GetRefCounter();
+            }
+        }
+
+        inline void InternalAddRef() const
+        {
+            if (m_pCounter)
+            {
+                m_pCounter->AddWeakRef();
+            }
+        }
+
+        inline void InternalRelease()
+        {
+            if (m_pCounter)
+            {
+                m_pCounter->ReleaseWeakRef();
+                m_pObject  = nullptr;
+                m_pCounter = nullptr;
+            }
+        }
+
+    public:
+        UN_RTTI_Struct(WeakPtr<T>, "74658E96-7F3D-4823-B33C-27761ACE0B84");
+
+        //! \brief Create a _null_ weak pointer.
+        inline WeakPtr() noexcept = default;
+
+        //! \brief Create a weak pointer to the specified object.
+        //!
+        //! \param pObject - The pointer to a live object.
+        inline WeakPtr(T* pObject) noexcept // NOLINT
+            : m_pObject(pObject)
+            , m_pCounter(pObject ? GetRefCounter(pObject) : nullptr)
+        {
+            InternalAddRef();
+        }
+
+        //! \brief Create a weak pointer to the object held by a strong pointer.
+        //!
+        //! \param pObject - The strong pointer.
+        template<class T1>
+        inline WeakPtr(const Ptr<T1>& pObject) noexcept // NOLINT
+            : WeakPtr(pObject.Get())
+        {
+        }
+
+        inline WeakPtr(const WeakPtr& other) noexcept
+            : m_pObject(other.m_pObject)
+            , m_pCounter(other.m_pCounter)
+        {
+            InternalAddRef();
+        }
+
+        template<class T1>
+        inline WeakPtr(const WeakPtr<T1>& other) noexcept // NOLINT
+            : m_pObject(other.m_pObject)
+            , m_pCounter(other.m_pCounter)
+        {
+            InternalAddRef();
+        }
+
+        inline WeakPtr(WeakPtr&& other) noexcept
+            : m_pObject(other.m_pObject)
+            , m_pCounter(other.m_pCounter)
+        {
+            other.m_pObject  = nullptr;
+            other.m_pCounter = nullptr;
+        }
+
+        inline WeakPtr& operator=(const WeakPtr& other)
+        {
+            WeakPtr(other).Swap(*this);
+            return *this;
+        }
+
+        inline WeakPtr& operator=(WeakPtr&& other) noexcept
+        {
+            WeakPtr(std::move(other)).Swap(*this);
+            return *this;
+        }
+
+        inline ~WeakPtr()
+        {
+            InternalRelease();
+        }
+
+        //! \brief Swap two weak pointers without changing the reference counters.
+        inline void Swap(WeakPtr& other)
+        {
+            std::swap(m_pObject, other.m_pObject);
+            std::swap(m_pCounter, other.m_pCounter);
+        }
+
+        //! \brief Set a pointer to _null_.
+        inline void Reset()
+        {
+            InternalRelease();
+        }
+
+        //! \brief Get a strong reference to the object.
+        //!
+        //! This function is lock-free: it only increments the number of strong references
+        //! if it hasn't reached zero yet.
+        //!
+        //! \return A strong pointer to the object or _null_ if it was already destroyed.
+        [[nodiscard]] inline Ptr<T> TryLock() const
+        {
+            Ptr<T> result;
+            if (m_pCounter && m_pCounter->TryAddStrongRef())
+            {
+                result.Attach(m_pObject);
+            }
+
+            return result;
+        }
+
+        //! \brief Check if the object was destroyed.
+        [[nodiscard]] inline bool Expired() const
+        {
+            return m_pCounter == nullptr || m_pCounter->GetStrongRefCount() == 0;
+        }
+    };
+
+    template<class T>
+    struct IsTriviallyRelocatable<WeakPtr<T>> : std::true_type
+    {
+    };
+} // namespace UN
@@ -0,0 +1,246 @@
+#pragma once
+#include <UnTL/Parallel/SpscRingBuffer.h>
+
+namespace UN
+{
+    //! \brief A bounded lock-free queue for any number of producer and consumer threads.
+    //!
+    //! The queue is an array of cells of power-of-two capacity, each cell has a sequence number that says
+    //! whether the cell is ready to be written or read on the current lap of the ring buffer. Producers and
+    //! consumers claim cells by incrementing their own position index with compare-and-swap, the indices
+    //! are on separate cache lines. An element becomes visible to the consumers when the producer that
+    //! claimed its cell stores the next sequence number, so a slow producer never blocks the other producers.
+    //!
+    //! The batch operations claim a run of consecutive ready cells with a single compare-and-swap.
+    //!
+    //! \note The class is thread-safe.
+    //!
+    //! \tparam T - Type of the elements.
+    template<class T>
+    class MpmcQueue final
+    {
+        struct Cell
+        {
+            std::atomic<USize> Sequence;
+            alignas(T) UInt8 Storage[sizeof(T)];
+
+            [[nodiscard]] UN_FINLINE T* GetElement() noexcept
+            {
+                return reinterpret_cast<T*>(Storage);
+            }
+        };
+
+        alignas(CacheLineSize) std::atomic<USize> m_EnqueuePosition{ 0 };
+        alignas(CacheLineSize) std::atomic<USize> m_DequeuePosition{ 0 };
+        alignas(CacheLineSize) HeapArray<Cell> m_Cells;
+        USize m_Mask;
+
+        //! \brief Claim up to maxCount consecutive cells whose sequence numbers are equal to position + offset.
+        //!
+        //! \return The number of claimed cells, the first claimed position is stored to position.
+        inline USize Claim(std::atomic<USize>& index, USize& position, USize maxCount, USize offset)
+        {
+            position = index.load(std::memory_order_relaxed);
+            while (true)
+            {
+                USize count = 0;
+                while (count < maxCount)
+                {
+                    const USize sequence = m_Cells[(position + count) & m_Mask].Sequence.load(std::memory_order_acquire);
+                    if (sequence != position + count + offset)
+                    {
+                        break;
+                    }
+
+                    ++count;
+                }
+
+                if (count == 0)
+                {
+                    const USize sequence = m_Cells[position & m_Mask].Sequence.load(std::memory_order_acquire);
+                    if (static_cast<SSize>(sequence - (position + offset)) < 0)
+                    {
+                        // The cell is still in use on the previous lap: the queue is full (or empty).
+                        return 0;
+                    }
+
+                    // Another thread has claimed the cell, try again from the new position.
+                    position = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (index.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+                {
+                    return count;
+                }
+            }
+        }
+
+        inline USize ClaimForPush(USize& position, USize maxCount)
+        {
+            return Claim(m_EnqueuePosition, position, maxCount, 0);
+        }
+
+        inline USize ClaimForPop(USize& position, USize maxCount)
+        {
+            return Claim(m_DequeuePosition, position, maxCount, 1);
+        }
+
+        inline void Publish(USize position) noexcept
+        {
+            m_Cells[position & m_Mask].Sequence.store(position + 1, std::memory_order_release);
+        }
+
+        inline void Release(USize position) noexcept
+        {
+            m_Cells[position & m_Mask].Sequence.store(position + m_Mask + 1, std::memory_order_release);
+        }
+
+    public:
+        //! \brief Create a queue.
+        //!
+        //! \param capacity   - The maximum number of elements in the queue, rounded up to a power of two.
+        //! \param pAllocator - The allocator to use for the storage.
+        inline explicit MpmcQueue(USize capacity, IAllocator* pAllocator = SystemAllocator::Get())
+            : m_Cells(HeapArray<Cell>::CreateUninitialized(pAllocator, Internal::GetQueueCapacity(capacity)))
+            , m_Mask(m_Cells.Length() - 1)
+        {
+            for (USize i = 0; i < m_Cells.Length(); ++i)
+            {
+                new (&m_Cells[i].Sequence) std::atomic<USize>(i);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&)            = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        inline ~MpmcQueue()
+        {
+            const USize end = m_EnqueuePosition.load(std::memory_order_relaxed);
+            for (USize i = m_DequeuePosition.load(std::memory_order_relaxed); i != end; ++i)
+            {
+                m_Cells[i & m_Mask].GetElement()->~T();
+            }
+        }
+
+        //! \brief Get the maximum number of elements in the queue.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Mask + 1;
+        }
+
+        //! \brief Get the approximate number of elements in the queue.
+        [[nodiscard]] inline USize ApproxSize() const noexcept
+        {
+            const USize dequeuePosition = m_DequeuePosition.load(std::memory_order_relaxed);
+            const USize enqueuePosition = m_EnqueuePosition.load(std::memory_order_relaxed);
+            return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+        }
+
+        //! \brief Construct an element at the end of the queue if the queue is not full.
+        //!
+        //! \param args - The arguments to construct the element with.
+        //!
+        //! \return True if the element was added.
+        template<class... Args>
+        inline bool TryEmplace(Args&&... args)
+        {
+            USize position;
+            if (ClaimForPush(position, 1) == 0)
+            {
+                return false;
+            }
+
+            new (m_Cells[position & m_Mask].GetElement()) T(std::forward<Args>(args)...);
+            Publish(position);
+            return true;
+        }
+
+        //! \brief Add an element to the end of the queue if the queue is not full.
+        //!
+        //! \return True if the element was added.
+        inline bool TryPush(const T& value)
+        {
+            return TryEmplace(value);
+        }
+
+        //! \brief Add an element to the end of the queue if the queue is not full.
+        //!
+        //! \return True if the element was added.
+        inline bool TryPush(T&& value)
+        {
+            return TryEmplace(std::move(value));
+        }
+
+        //! \brief Copy as many elements as there is space for to the end of the queue.
+        //!
+        //! The elements are added to consecutive positions, but may interleave with the elements
+        //! of other producers if the queue becomes full.
+        //!
+        //! \param values - The elements to add.
+        //!
+        //! \return The number of elements that were added, the first N elements of the slice.
+        inline USize TryPushBatch(ArraySlice<const T> values)
+        {
+            if (values.Empty())
+            {
+                return 0;
+            }
+
+            USize position;
+            const USize count = ClaimForPush(position, values.Length());
+            for (USize i = 0; i < count; ++i)
+            {
+                new (m_Cells[(position + i) & m_Mask].GetElement()) T(values[i]);
+                Publish(position + i);
+            }
+
+            return count;
+        }
+
+        //! \brief Remove an element from the beginning of the queue if the queue is not empty.
+        //!
+        //! \param result - The variable to move the removed element to.
+        //!
+        //! \return True if an element was removed.
+        inline bool TryPop(T& result)
+        {
+            USize position;
+            if (ClaimForPop(position, 1) == 0)
+            {
+                return false;
+            }
+
+            T* pElement = m_Cells[position & m_Mask].GetElement();
+            result      = std::move(*pElement);
+            pElement->~T();
+            Release(position);
+            return true;
+        }
+
+        //! \brief Remove as many elements as available and as fit into the destination slice.
+        //!
+        //! \param destination - The slice to move the removed elements to.
+        //!
+        //! \return The number of removed elements.
+        inline USize TryPopBatch(ArraySlice<T> destination)
+        {
+            if (destination.Empty())
+            {
+                return 0;
+            }
+
+            USize position;
+            const USize count = ClaimForPop(position, destination.Length());
+            for (USize i = 0; i < count; ++i)
+            {
+                T* pElement    = m_Cells[(position + i) & m_Mask].GetElement();
+                destination[i] = std::move(*pElement);
+                pElement->~T();
+                Release(position + i);
+            }
+
+            return count;
+        }
+    };
+} // namespace UN
@@ -0,0 +1,204 @@
+#pragma once
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Memory/SystemAllocator.h>
+#include <UnTL/Parallel/ThreadPool.h>
+#include <iterator>
+
+namespace UN
+{
+    //! \brief Options for ParallelSort.
+    struct ParallelSortOptions
+    {
+        //! The thread pool to sort on, the default pool is used if nullptr.
+        ThreadPool* pPool = nullptr;
+
+        //! The minimum number of elements sorted or merged by a single task.
+        USize GrainSize = 16 * 1024;
+
+        //! The allocator for the temporary buffer, SystemAllocator is used if nullptr.
+        IAllocator* pAllocator = nullptr;
+    };
+
+    namespace Internal
+    {
+        template<class T, class TPred>
+        class ParallelMergeSort final
+        {
+            TPred& m_Pred;
+            ThreadPool* m_pPool;
+            USize m_GrainSize;
+            USize m_LeafSize;
+
+        public:
+            inline ParallelMergeSort(TPred& pred, ThreadPool* pPool, USize grainSize, USize leafSize)
+                : m_Pred(pred)
+                , m_pPool(pPool)
+                , m_GrainSize(grainSize)
+                , m_LeafSize(leafSize)
+            {
+            }
+
+            //! \brief Move-merge two sorted ranges into pDest, splitting large ranges by binary search.
+            inline void Merge(T* pFirst1, T* pLast1, T* pFirst2, T* pLast2, T* pDest)
+            {
+                const USize length1 = static_cast<USize>(pLast1 - pFirst1);
+                const USize length2 = static_cast<USize>(pLast2 - pFirst2);
+                if (length1 + length2 <= m_GrainSize)
+                {
+                    std::merge(std::make_move_iterator(pFirst1),
+                               std::make_move_iterator(pLast1),
+                               std::make_move_iterator(pFirst2),
+                               std::make_move_iterator(pLast2),
+                               pDest,
+                               m_Pred);
+                    return;
+                }
+
+                // Split the larger range in half and the other one at the same value.
+                T* pMiddle1;
+                T* pMiddle2;
+                if (length1 >= length2)
+                {
+                    pMiddle1 = pFirst1 + length1 / 2;
+                    pMiddle2 = std::lower_bound(pFirst2, pLast2, *pMiddle1, m_Pred);
+                }
+                else
+                {
+                    pMiddle2 = pFirst2 + length2 / 2;
+                    pMiddle1 = std::upper_bound(pFirst1, pLast1, *pMiddle2, m_Pred);
+                }
+
+                T* pDestMiddle = pDest + (pMiddle1 - pFirst1) + (pMiddle2 - pFirst2);
+
+                TaskGroup group(m_pPool);
+                auto left = [&] {
+                    Merge(pFirst1, pMiddle1, pFirst2, pMiddle2, pDest);
+                };
+
+                group.Run(left);
+                Merge(pMiddle1, pLast1, pMiddle2, pLast2, pDestMiddle);
+                group.Wait();
+            }
+
+            //! \brief Sort the elements of pData, the result is stored in pBuffer if toBuffer is true.
+            //!
+            //! Both arrays must contain constructed elements, pBuffer is used as scratch space.
+            inline void Sort(T* pData, T* pBuffer, USize length, bool toBuffer)
+            {
+                if (length <= m_LeafSize)
+                {
+                    std::sort(pData, pData + length, m_Pred);
+                    if (toBuffer)
+                    {
+                        std::move(pData, pData + length, pBuffer);
+                    }
+
+                    return;
+                }
+
+                // Sort the halves into the other array, so that merging them puts the result to the requested one.
+                const USize half = length / 2;
+
+                TaskGroup group(m_pPool);
+                auto left = [&] {
+                    Sort(pData, pBuffer, half, !toBuffer);
+                };
+
+                group.Run(left);
+                Sort(pData + half, pBuffer + half, length - half, !toBuffer);
+                group.Wait();
+
+                T* pSource = toBuffer ? pData : pBuffer;
+                T* pDest   = toBuffer ? pBuffer : pData;
+                Merge(pSource, pSource + half, pSource + half, pSource + length, pDest);
+            }
+        };
+    } // namespace Internal
+
+    //! \brief Sort elements by predicate using parallel merge sort.
+    //!
+    //! The slice is split into ranges of at least GrainSize elements that are sorted with std::sort on the
+    //! threads of the pool, then merged in parallel. The sort is not stable and needs a temporary
+    //! buffer of the same size as the slice.
+    //!
+    //! Predicate signature:
+    //! \code{.cpp}
+    //!     bool pred(const T& left, const T& right);
+    //! \endcode
+    //!
+    //! \param data    - The elements to sort.
+    //! \param pred    - A functor to use as the sorting predicate.
+    //! \param options - Sort options.
+    template<class T, class TPred, class = std::enable_if_t<std::is_invocable_r_v<bool, TPred&, const T&, const T&>>>
+    inline void ParallelSort(ArraySlice<T> data, TPred&& pred, const ParallelSortOptions& options = {})
+    {
+        UN_Assert(options.GrainSize > 0, "Grain size must be positive");
+
+        const USize length = data.Length();
+        if (length <= options.GrainSize)
+        {
+            std::sort(data.Data(), data.Data() + length, pred);
+            return;
+        }
+
+        ThreadPool* pPool      = options.pPool ? options.pPool : ThreadPool::GetDefault();
+        IAllocator* pAllocator = options.pAllocator ? options.pAllocator : SystemAllocator::Get();
+
+        T* pData   = data.Data();
+        T* pBuffer = static_cast<T*>(pAllocator->Allocate(length * sizeof(T), alignof(T)));
+        ParallelFor(pPool, 0, length, options.GrainSize, [pData, pBuffer](USize begin, USize end) {
+            std::uninitialized_move(pData + begin, pData + end, pBuffer + begin);
+        });
+
+        // Every merge level moves all the elements, so don't split the sorted ranges further than needed
+        // to keep all the threads busy.
+        const USize leafSize = std::max(options.GrainSize, length / (pPool->Concurrency() * 4) + 1);
+
+        // The buffer now holds the elements and the data holds moved-from objects, sort from the buffer back into the data.
+        Internal::ParallelMergeSort<T, std::remove_reference_t<TPred>>(pred, pPool, options.GrainSize, leafSize)
+            .Sort(pBuffer, pData, length, true);
+
+        ParallelFor(pPool, 0, length, options.GrainSize, [pBuffer](USize begin, USize end) {
+            std::destroy(pBuffer + begin, pBuffer + end);
+        });
+
+        pAllocator->Deallocate(pBuffer, length * sizeof(T), alignof(T));
+    }
+
+    //! \brief Sort elements in ascending order using parallel merge sort, see ParallelSort(ArraySlice<T>, TPred&&, ...).
+    template<class T>
+    inline void ParallelSort(ArraySlice<T> data, const ParallelSortOptions& options = {})
+    {
+        ParallelSort(data, std::less<>{}, options);
+    }
+
+    //! \brief Sort elements using a member of T as sorting key, see ParallelSort(ArraySlice<T>, TPred&&, ...).
+    //!
+    //! \param data       - The elements to sort.
+    //! \param member     - Pointer to data member or member function to use as sorting key.
+    //! \param descending - True if the elements must be sorted in descending order.
+    //! \param options    - Sort options.
+    template<class T, class TMember>
+    inline void ParallelSortByMember(ArraySlice<T> data, TMember member, bool descending = false,
+                                     const ParallelSortOptions& options = {})
+    {
+        if (descending)
+        {
+            ParallelSort(
+                data,
+                [member](const T& lhs, const T& rhs) {
+                    return std::invoke(member, lhs) > std::invoke(member, rhs);
+                },
+                options);
+        }
+        else
+        {
+            ParallelSort(
+                data,
+                [member](const T& lhs, const T& rhs) {
+                    return std::invoke(member, lhs) < std::invoke(member, rhs);
+                },
+                options);
+        }
+    }
+} // namespace UN
@@ -0,0 +1,205 @@
+#pragma once
+#include <UnTL/Containers/HeapArray.h>
+#include <atomic>
+
+namespace UN
+{
+    namespace Internal
+    {
+        //! \brief Round the capacity of a queue up to a power of two.
+        inline USize GetQueueCapacity(USize capacity) noexcept
+        {
+            UN_Assert(capacity > 0, "Queue capacity must be positive");
+
+            USize result = 1;
+            while (result < capacity)
+            {
+                result *= 2;
+            }
+
+            return result;
+        }
+    } // namespace Internal
+
+    //! \brief A bounded lock-free queue for exactly one producer thread and one consumer thread.
+    //!
+    //! The elements are stored in a ring buffer of power-of-two capacity. The producer only writes the tail
+    //! index and the consumer only writes the head index, each index is on its own cache line. Both threads
+    //! also keep a cached copy of the other index, so they only touch the shared cache line when the cached
+    //! value says the queue is full (or empty).
+    //!
+    //! The batch operations publish all the elements with a single atomic store, which is much cheaper than
+    //! pushing or popping them one by one.
+    //!
+    //! \note Push methods must only be called by the producer thread and Pop methods only by the consumer thread.
+    //!
+    //! \tparam T - Type of the elements.
+    template<class T>
+    class SpscRingBuffer final
+    {
+        alignas(CacheLineSize) std::atomic<USize> m_Head{ 0 };
+        USize m_CachedTail = 0;
+
+        alignas(CacheLineSize) std::atomic<USize> m_Tail{ 0 };
+        USize m_CachedHead = 0;
+
+        alignas(CacheLineSize) HeapArray<T> m_Storage;
+        USize m_Mask;
+
+        //! \brief Get the number of free slots, called by the producer.
+        //!
+        //! The head index is only reloaded if the cached one doesn't leave enough space for the requested elements.
+        [[nodiscard]] inline USize GetFreeCount(USize tail, USize requested) noexcept
+        {
+            const USize capacity = m_Mask + 1;
+            if (capacity - (tail - m_CachedHead) < requested)
+            {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+            }
+
+            return capacity - (tail - m_CachedHead);
+        }
+
+        //! \brief Get the number of available elements, called by the consumer.
+        //!
+        //! The tail index is only reloaded if the cached one doesn't have enough elements.
+        [[nodiscard]] inline USize GetAvailableCount(USize head, USize requested) noexcept
+        {
+            if (m_CachedTail - head < requested)
+            {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            }
+
+            return m_CachedTail - head;
+        }
+
+    public:
+        //! \brief Create a queue.
+        //!
+        //! \param capacity   - The maximum number of elements in the queue, rounded up to a power of two.
+        //! \param pAllocator - The allocator to use for the storage.
+        inline explicit SpscRingBuffer(USize capacity, IAllocator* pAllocator = SystemAllocator::Get())
+            : m_Storage(HeapArray<T>::CreateUninitialized(pAllocator, Internal::GetQueueCapacity(capacity)))
+            , m_Mask(m_Storage.Length() - 1)
+        {
+        }
+
+        SpscRingBuffer(const SpscRingBuffer&)            = delete;
+        SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+        inline ~SpscRingBuffer()
+        {
+            const USize tail = m_Tail.load(std::memory_order_relaxed);
+            for (USize i = m_Head.load(std::memory_order_relaxed); i != tail; ++i)
+            {
+                m_Storage[i & m_Mask].~T();
+            }
+        }
+
+        //! \brief Get the maximum number of elements in the queue.
+        [[nodiscard]] inline USize Capacity() const noexcept
+        {
+            return m_Mask + 1;
+        }
+
+        //! \brief Get the approximate number of elements in the queue.
+        [[nodiscard]] inline USize ApproxSize() const noexcept
+        {
+            const USize head = m_Head.load(std::memory_order_relaxed);
+            return m_Tail.load(std::memory_order_relaxed) - head;
+        }
+
+        //! \brief Construct an element at the end of the queue if the queue is not full.
+        //!
+        //! \param args - The arguments to construct the element with.
+        //!
+        //! \return True if the element was added.
+        template<class... Args>
+        inline bool TryEmplace(Args&&... args)
+        {
+            const USize tail = m_Tail.load(std::memory_order_relaxed);
+            if (GetFreeCount(tail, 1) == 0)
+            {
+                return false;
+            }
+
+            new (&m_Storage[tail & m_Mask]) T(std::forward<Args>(args)...);
+            m_Tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        //! \brief Add an element to the end of the queue if the queue is not full.
+        //!
+        //! \return True if the element was added.
+        inline bool TryPush(const T& value)
+        {
+            return TryEmplace(value);
+        }
+
+        //! \brief Add an element to the end of the queue if the queue is not full.
+        //!
+        //! \return True if the element was added.
+        inline bool TryPush(T&& value)
+        {
+            return TryEmplace(std::move(value));
+        }
+
+        //! \brief Copy as many elements as there is space for to the end of the queue.
+        //!
+        //! \param values - The elements to add.
+        //!
+        //! \return The number of elements that were added, the first N elements of the slice.
+        inline USize TryPushBatch(ArraySlice<const T> values)
+        {
+            const USize tail  = m_Tail.load(std::memory_order_relaxed);
+            const USize count = std::min(values.Length(), GetFreeCount(tail, values.Length()));
+            for (USize i = 0; i < count; ++i)
+            {
+                new (&m_Storage[(tail + i) & m_Mask]) T(values[i]);
+            }
+
+            m_Tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        //! \brief Remove an element from the beginning of the queue if the queue is not empty.
+        //!
+        //! \param result - The variable to move the removed element to.
+        //!
+        //! \return True if an element was removed.
+        inline bool TryPop(T& result)
+        {
+            const USize head = m_Head.load(std::memory_order_relaxed);
+            if (GetAvailableCount(head, 1) == 0)
+            {
+                return false;
+            }
+
+            T& element = m_Storage[head & m_Mask];
+            result     = std::move(element);
+            element.~T();
+            m_Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        //! \brief Remove as many elements as available and as fit into the destination slice.
+        //!
+        //! \param destination - The slice to move the removed elements to.
+        //!
+        //! \return The number of removed elements.
+        inline USize TryPopBatch(ArraySlice<T> destination)
+        {
+            const USize head  = m_Head.load(std::memory_order_relaxed);
+            const USize count = std::min(destination.Length(), GetAvailableCount(head, destination.Length()));
+            for (USize i = 0; i < count; ++i)
+            {
+                T& element     = m_Storage[(head + i) & m_Mask];
+                destination[i] = std::move(element);
+                element.~T();
+            }
+
+            m_Head.store(head + count, std::memory_order_release);
+            return count;
+        }
+    };
+} // namespace UN
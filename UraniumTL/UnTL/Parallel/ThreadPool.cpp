@@ -0,0 +1,189 @@
+#include <UnTL/Parallel/ThreadPool.h>
+
+namespace UN
+{
+    namespace
+    {
+        thread_local ThreadPool* CurrentPool = nullptr;
+        thread_local USize CurrentWorkerIndex = 0;
+    } // namespace
+
+    ThreadPool::ThreadPool(USize workerCount)
+        : m_pQueues(std::make_unique<TaskQueue[]>(workerCount + 1))
+        , m_QueueCount(workerCount + 1)
+    {
+        m_Workers.Reserve(workerCount);
+        for (USize i = 0; i < workerCount; ++i)
+        {
+            m_Workers.Emplace([this, i] {
+                WorkerMain(i);
+            });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_SleepMutex);
+            m_Stop = true;
+        }
+
+        m_SleepCondition.notify_all();
+        for (std::thread& worker : m_Workers)
+        {
+            worker.join();
+        }
+    }
+
+    ThreadPool* ThreadPool::GetDefault()
+    {
+        static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        return &pool;
+    }
+
+    USize ThreadPool::GetCurrentQueueIndex() const noexcept
+    {
+        // The last queue is shared by all the threads that are not workers of this pool.
+        return CurrentPool == this ? CurrentWorkerIndex : m_QueueCount - 1;
+    }
+
+    void ThreadPool::WorkerMain(USize workerIndex)
+    {
+        CurrentPool        = this;
+        CurrentWorkerIndex = workerIndex;
+
+        while (true)
+        {
+            if (TryRunTask())
+            {
+                continue;
+            }
+
+            std::unique_lock lock(m_SleepMutex);
+            m_SleepingWorkerCount.fetch_add(1);
+            m_SleepCondition.wait(lock, [this] {
+                return m_Stop || m_QueuedTaskCount.load() > 0;
+            });
+
+            m_SleepingWorkerCount.fetch_sub(1);
+            if (m_Stop && m_QueuedTaskCount.load() == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    void ThreadPool::Push(const Task& task)
+    {
+        TaskQueue& queue = m_pQueues[GetCurrentQueueIndex()];
+        {
+            std::lock_guard lock(queue.Mutex);
+            queue.Tasks.push_back(task);
+            m_QueuedTaskCount.fetch_add(1);
+        }
+
+        // A worker increments the sleeping count before checking the queued task count, so either
+        // we see the sleeping worker here or it sees the new task and doesn't go to sleep.
+        const bool hasSleepingWorkers = m_SleepingWorkerCount.load() > 0;
+        const bool hasWaitingThreads  = m_WaitingThreadCount.load() > 0;
+        if (hasSleepingWorkers || hasWaitingThreads)
+        {
+            {
+                std::lock_guard lock(m_SleepMutex);
+            }
+
+            if (hasSleepingWorkers)
+            {
+                m_SleepCondition.notify_one();
+            }
+            else
+            {
+                m_WaitCondition.notify_one();
+            }
+        }
+    }
+
+    bool ThreadPool::TryPop(USize queueIndex, bool back, Task& task)
+    {
+        TaskQueue& queue = m_pQueues[queueIndex];
+        std::lock_guard lock(queue.Mutex);
+        if (queue.Tasks.empty())
+        {
+            return false;
+        }
+
+        if (back)
+        {
+            task = queue.Tasks.back();
+            queue.Tasks.pop_back();
+        }
+        else
+        {
+            task = queue.Tasks.front();
+            queue.Tasks.pop_front();
+        }
+
+        m_QueuedTaskCount.fetch_sub(1);
+        return true;
+    }
+
+    bool ThreadPool::TryRunTask()
+    {
+        if (m_QueuedTaskCount.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        // Take the newest task from our own queue first, then steal the oldest ones from the others.
+        const USize ownIndex = GetCurrentQueueIndex();
+
+        Task task;
+        bool found = TryPop(ownIndex, true, task);
+        for (USize i = 1; i < m_QueueCount && !found; ++i)
+        {
+            found = TryPop((ownIndex + i) % m_QueueCount, false, task);
+        }
+
+        if (!found)
+        {
+            return false;
+        }
+
+        task.pInvoke(task.pData);
+
+        // The group can be destroyed as soon as the count reaches zero, don't touch it after that.
+        // Same as in Push(), a waiting thread increments the waiting count before checking the pending count.
+        if (task.pGroup->m_PendingCount.fetch_sub(1) == 1 && m_WaitingThreadCount.load() > 0)
+        {
+            {
+                std::lock_guard lock(m_SleepMutex);
+            }
+
+            m_WaitCondition.notify_all();
+        }
+
+        return true;
+    }
+
+    void ThreadPool::WaitForWork(const TaskGroup& group)
+    {
+        std::unique_lock lock(m_SleepMutex);
+        m_WaitingThreadCount.fetch_add(1);
+        m_WaitCondition.wait(lock, [this, &group] {
+            return group.m_PendingCount.load() == 0 || m_QueuedTaskCount.load() > 0;
+        });
+
+        m_WaitingThreadCount.fetch_sub(1);
+    }
+
+    void TaskGroup::Wait()
+    {
+        while (m_PendingCount.load(std::memory_order_acquire) != 0)
+        {
+            if (!m_pPool->TryRunTask())
+            {
+                m_pPool->WaitForWork(*this);
+            }
+        }
+    }
+} // namespace UN
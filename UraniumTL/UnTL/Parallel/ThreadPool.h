@@ -0,0 +1,194 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Containers/List.h>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace UN
+{
+    class TaskGroup;
+
+    //! \brief A pool of worker threads that run short fork-join tasks.
+    //!
+    //! Every worker has its own task queue. A worker pushes the tasks it spawns to the back of its own queue
+    //! and takes them from the back, so the most recently spawned (and usually smallest and cache-hot) task runs
+    //! first. When its queue is empty, a worker steals the oldest task from the front of another queue.
+    //! Tasks spawned by threads that are not workers of the pool go to a separate shared queue.
+    //!
+    //! Tasks are spawned and waited for through a TaskGroup. A thread that waits for a group runs tasks from
+    //! the pool until all the tasks of the group are complete. This makes recursive fork-join algorithms safe
+    //! on any number of threads, including a pool without workers. When there is nothing to run, but some tasks
+    //! of the group are still running on other threads, the waiting thread sleeps until either the group
+    //! completes or a new task is queued.
+    //!
+    //! \note The class is thread-safe.
+    class ThreadPool final
+    {
+        friend class TaskGroup;
+
+        struct Task
+        {
+            void (*pInvoke)(void*);
+            void* pData;
+            TaskGroup* pGroup;
+        };
+
+        struct alignas(CacheLineSize) TaskQueue
+        {
+            std::mutex Mutex;
+            std::deque<Task> Tasks;
+        };
+
+        std::unique_ptr<TaskQueue[]> m_pQueues;
+        List<std::thread> m_Workers;
+        USize m_QueueCount;
+
+        std::atomic<USize> m_QueuedTaskCount{ 0 };
+        std::atomic<USize> m_SleepingWorkerCount{ 0 };
+        std::atomic<USize> m_WaitingThreadCount{ 0 };
+        std::mutex m_SleepMutex;
+        std::condition_variable m_SleepCondition;
+        std::condition_variable m_WaitCondition;
+        bool m_Stop = false;
+
+        void WorkerMain(USize workerIndex);
+
+        void Push(const Task& task);
+        bool TryPop(USize queueIndex, bool back, Task& task);
+        bool TryRunTask();
+        void WaitForWork(const TaskGroup& group);
+
+        [[nodiscard]] USize GetCurrentQueueIndex() const noexcept;
+
+    public:
+        //! \brief Create a thread pool.
+        //!
+        //! \param workerCount - The number of worker threads to create. The threads waiting for a TaskGroup also
+        //!                      run tasks, so a pool without workers is valid and runs everything on the waiting thread.
+        explicit ThreadPool(USize workerCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        //! \brief Get the number of worker threads.
+        [[nodiscard]] inline USize WorkerCount() const noexcept
+        {
+            return m_Workers.Size();
+        }
+
+        //! \brief Get the maximum number of threads that can run tasks concurrently: the workers and the waiting thread.
+        [[nodiscard]] inline USize Concurrency() const noexcept
+        {
+            return m_Workers.Size() + 1;
+        }
+
+        //! \brief Get a global thread pool that has a worker for each hardware thread except the calling one.
+        static ThreadPool* GetDefault();
+    };
+
+    //! \brief A group of tasks that are run on a ThreadPool and can be waited for together.
+    //!
+    //! The group doesn't copy the function objects: they must stay alive until Wait() returns.
+    //! The destructor waits for all the tasks of the group.
+    //!
+    //! \code{.cpp}
+    //!     TaskGroup group(pPool);
+    //!     auto left = [&] { Process(first); };
+    //!     group.Run(left);
+    //!     Process(second);
+    //!     group.Wait();
+    //! \endcode
+    class TaskGroup final
+    {
+        friend class ThreadPool;
+
+        ThreadPool* m_pPool;
+        std::atomic<USize> m_PendingCount{ 0 };
+
+        template<class F>
+        inline static void Invoke(void* pData) noexcept
+        {
+            (*static_cast<F*>(pData))();
+        }
+
+    public:
+        //! \brief Create a task group.
+        //!
+        //! \param pPool - The thread pool to run the tasks on, the default pool is used if nullptr.
+        inline explicit TaskGroup(ThreadPool* pPool = nullptr)
+            : m_pPool(pPool ? pPool : ThreadPool::GetDefault())
+        {
+        }
+
+        inline ~TaskGroup()
+        {
+            Wait();
+        }
+
+        TaskGroup(const TaskGroup&)            = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        //! \brief Get the thread pool the tasks are run on.
+        [[nodiscard]] inline ThreadPool* GetPool() const noexcept
+        {
+            return m_pPool;
+        }
+
+        //! \brief Schedule a function to run on the pool.
+        //!
+        //! \param f - The function object to call, must outlive Wait() and must not throw.
+        template<class F>
+        inline void Run(F& f)
+        {
+            m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+            m_pPool->Push(ThreadPool::Task{ &Invoke<F>, &f, this });
+        }
+
+        //! \brief Wait for all the scheduled tasks to complete.
+        //!
+        //! Runs the tasks of the pool while waiting and sleeps when there are none left to run.
+        void Wait();
+    };
+
+    //! \brief Call a function for all subranges of [begin, end) in parallel.
+    //!
+    //! Function signature:
+    //! \code{.cpp}
+    //!     void f(USize begin, USize end);
+    //! \endcode
+    //!
+    //! \param pPool     - The thread pool to run the tasks on, the default pool is used if nullptr.
+    //! \param begin     - The beginning of the range.
+    //! \param end       - The end of the range.
+    //! \param grainSize - The maximum size of a subrange processed by a single call.
+    //! \param f         - The function to call.
+    template<class F>
+    inline void ParallelFor(ThreadPool* pPool, USize begin, USize end, USize grainSize, F&& f)
+    {
+        UN_Assert(grainSize > 0, "Grain size must be positive");
+        if (end - begin <= grainSize)
+        {
+            if (begin < end)
+            {
+                f(begin, end);
+            }
+
+            return;
+        }
+
+        const USize middle = begin + (end - begin) / 2;
+
+        TaskGroup group(pPool);
+        auto left = [&] {
+            ParallelFor(group.GetPool(), begin, middle, grainSize, f);
+        };
+
+        group.Run(left);
+        ParallelFor(group.GetPool(), middle, end, grainSize, f);
+        group.Wait();
+    }
+} // namespace UN
@@ -0,0 +1,510 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Utils/BitUtils.h>
+
+#if UN_AVX2_SUPPORTED || UN_SSE41_SUPPORTED
+#    include <immintrin.h>
+#endif
+
+namespace UN::UTF8::Internal
+{
+    //! \brief True if the byte is not a continuation byte (10xxxxxx), i.e. starts a codepoint.
+    UN_FINLINE bool IsCodepointStart(UInt8 byte) noexcept
+    {
+        return (byte & 0xc0) != 0x80;
+    }
+
+    //! \brief Get the number of continuation bytes after a lead byte and the allowed range of the first one.
+    //!
+    //! The range excludes overlong encodings, surrogates and codepoints above U+10FFFF (see Table 3-7
+    //! of the Unicode Standard), the rest of the continuation bytes are always 0x80..0xbf.
+    //!
+    //! \return False if the byte can't start a multi-byte sequence.
+    UN_FINLINE bool GetSequenceRange(UInt8 lead, USize& tailLength, UInt8& min, UInt8& max) noexcept
+    {
+        min = 0x80;
+        max = 0xbf;
+        if (lead >= 0xc2 && lead <= 0xdf)
+        {
+            tailLength = 1;
+        }
+        else if (lead >= 0xe0 && lead <= 0xef)
+        {
+            tailLength = 2;
+            min        = lead == 0xe0 ? 0xa0 : 0x80; // overlong
+            max        = lead == 0xed ? 0x9f : 0xbf; // surrogates
+        }
+        else if (lead >= 0xf0 && lead <= 0xf4)
+        {
+            tailLength = 3;
+            min        = lead == 0xf0 ? 0x90 : 0x80; // overlong
+            max        = lead == 0xf4 ? 0x8f : 0xbf; // above U+10FFFF
+        }
+        else
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    //! \brief Validate UTF-8 one codepoint at a time, skipping 8 ASCII bytes at a time.
+    //!
+    //! Rejects overlong encodings, surrogates, codepoints above U+10FFFF and truncated sequences
+    //! (see Table 3-7 of the Unicode Standard).
+    inline bool ValidateScalar(const UInt8* pData, USize length) noexcept
+    {
+        USize index = 0;
+        while (index < length)
+        {
+            if (index + 8 <= length)
+            {
+                UInt64 word;
+                memcpy(&word, pData + index, sizeof(word));
+                if ((word & 0x8080808080808080ull) == 0)
+                {
+                    index += 8;
+                    continue;
+                }
+            }
+
+            const UInt8 lead = pData[index];
+            if (lead < 0x80)
+            {
+                ++index;
+                continue;
+            }
+
+            USize tailLength;
+            UInt8 min, max;
+            if (!GetSequenceRange(lead, tailLength, min, max))
+            {
+                return false;
+            }
+
+            if (length - index <= tailLength || pData[index + 1] < min || pData[index + 1] > max)
+            {
+                return false;
+            }
+
+            for (USize i = 2; i <= tailLength; ++i)
+            {
+                if (IsCodepointStart(pData[index + i]))
+                {
+                    return false;
+                }
+            }
+
+            index += tailLength + 1;
+        }
+
+        return true;
+    }
+
+    struct Sse2Utf8Ops
+    {
+        using Vector = __m128i;
+
+        inline static constexpr USize Width = 16;
+
+        UN_FINLINE static Vector Load(const void* pData) noexcept
+        {
+            return _mm_loadu_si128(static_cast<const __m128i*>(pData));
+        }
+
+        //! \brief Get a mask with a bit set for every byte that is not a continuation byte.
+        UN_FINLINE static UInt32 StartMask(Vector input) noexcept
+        {
+            // Continuation bytes are 0x80..0xbf, that is -128..-65 as signed bytes.
+            return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, _mm_set1_epi8(-65))));
+        }
+    };
+
+#if UN_SSE41_SUPPORTED
+    struct Sse41Utf8Ops : Sse2Utf8Ops
+    {
+        UN_FINLINE static Vector Broadcast(UInt8 value) noexcept
+        {
+            return _mm_set1_epi8(static_cast<char>(value));
+        }
+
+        UN_FINLINE static Vector Table(const UInt8 (&table)[16]) noexcept
+        {
+            return Load(table);
+        }
+
+        UN_FINLINE static Vector Zero() noexcept
+        {
+            return _mm_setzero_si128();
+        }
+
+        UN_FINLINE static Vector Or(Vector a, Vector b) noexcept
+        {
+            return _mm_or_si128(a, b);
+        }
+
+        UN_FINLINE static Vector And(Vector a, Vector b) noexcept
+        {
+            return _mm_and_si128(a, b);
+        }
+
+        UN_FINLINE static Vector Xor(Vector a, Vector b) noexcept
+        {
+            return _mm_xor_si128(a, b);
+        }
+
+        UN_FINLINE static Vector HighNibbles(Vector a) noexcept
+        {
+            return _mm_and_si128(_mm_srli_epi16(a, 4), _mm_set1_epi8(0x0f));
+        }
+
+        UN_FINLINE static Vector Lookup(Vector table, Vector indices) noexcept
+        {
+            return _mm_shuffle_epi8(table, indices);
+        }
+
+        UN_FINLINE static Vector SubSaturate(Vector a, Vector b) noexcept
+        {
+            return _mm_subs_epu8(a, b);
+        }
+
+        //! \brief Get the input shifted by N bytes with the last N bytes of the previous input shifted in.
+        template<int N>
+        UN_FINLINE static Vector Prev(Vector input, Vector prevInput) noexcept
+        {
+            return _mm_alignr_epi8(input, prevInput, 16 - N);
+        }
+
+        UN_FINLINE static bool IsAscii(Vector input) noexcept
+        {
+            return _mm_movemask_epi8(input) == 0;
+        }
+
+        UN_FINLINE static bool IsZero(Vector input) noexcept
+        {
+            return _mm_testz_si128(input, input);
+        }
+    };
+#endif
+
+#if UN_AVX2_SUPPORTED
+    struct Avx2Utf8Ops
+    {
+        using Vector = __m256i;
+
+        inline static constexpr USize Width = 32;
+
+        UN_FINLINE static Vector Load(const void* pData) noexcept
+        {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(pData));
+        }
+
+        UN_FINLINE static UInt32 StartMask(Vector input) noexcept
+        {
+            return static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, _mm256_set1_epi8(-65))));
+        }
+
+        UN_FINLINE static Vector Broadcast(UInt8 value) noexcept
+        {
+            return _mm256_set1_epi8(static_cast<char>(value));
+        }
+
+        //! \brief Broadcast the table to both 128-bit lanes, vpshufb looks up within a lane.
+        UN_FINLINE static Vector Table(const UInt8 (&table)[16]) noexcept
+        {
+            return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+        }
+
+        UN_FINLINE static Vector Zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        UN_FINLINE static Vector Or(Vector a, Vector b) noexcept
+        {
+            return _mm256_or_si256(a, b);
+        }
+
+        UN_FINLINE static Vector And(Vector a, Vector b) noexcept
+        {
+            return _mm256_and_si256(a, b);
+        }
+
+        UN_FINLINE static Vector Xor(Vector a, Vector b) noexcept
+        {
+            return _mm256_xor_si256(a, b);
+        }
+
+        UN_FINLINE static Vector HighNibbles(Vector a) noexcept
+        {
+            return _mm256_and_si256(_mm256_srli_epi16(a, 4), _mm256_set1_epi8(0x0f));
+        }
+
+        UN_FINLINE static Vector Lookup(Vector table, Vector indices) noexcept
+        {
+            return _mm256_shuffle_epi8(table, indices);
+        }
+
+        UN_FINLINE static Vector SubSaturate(Vector a, Vector b) noexcept
+        {
+            return _mm256_subs_epu8(a, b);
+        }
+
+        template<int N>
+        UN_FINLINE static Vector Prev(Vector input, Vector prevInput) noexcept
+        {
+            // vpalignr shifts within 128-bit lanes, so combine the upper lane of the previous input
+            // with the lower lane of the current input first.
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prevInput, input, 0x21), 16 - N);
+        }
+
+        UN_FINLINE static bool IsAscii(Vector input) noexcept
+        {
+            return _mm256_movemask_epi8(input) == 0;
+        }
+
+        UN_FINLINE static bool IsZero(Vector input) noexcept
+        {
+            return _mm256_testz_si256(input, input);
+        }
+    };
+#endif
+
+#if UN_SSE41_SUPPORTED
+    //! \brief Validator using the lookup algorithm by John Keiser and Daniel Lemire,
+    //! "Validating UTF-8 In Less Than One Instruction Per Byte" (2021).
+    //!
+    //! Every pair of consecutive bytes is classified with three 16-entry tables indexed by the high nibble
+    //! of the first byte, the low nibble of the first byte and the high nibble of the second byte. The AND
+    //! of the three lookups is non-zero only for invalid pairs, except for the pairs that are continuation
+    //! bytes of 3- and 4-byte sequences, which are checked separately by looking 2 and 3 bytes back.
+    template<class TOps>
+    class Utf8Validator final
+    {
+        using Vector = typename TOps::Vector;
+
+        // Error classes of a pair of bytes (first byte, second byte), a pair is invalid if any bit is set
+        // in all three lookups.
+        inline static constexpr UInt8 TooShort     = 1 << 0; // 11______ 0_______ or 11______ 11______
+        inline static constexpr UInt8 TooLong      = 1 << 1; // 0_______ 10______
+        inline static constexpr UInt8 Overlong3    = 1 << 2; // 11100000 100_____
+        inline static constexpr UInt8 TooLarge     = 1 << 3; // 11110100 1001____, 11110100 101_____, 11110101+ 10______
+        inline static constexpr UInt8 Surrogate    = 1 << 4; // 11101101 101_____
+        inline static constexpr UInt8 Overlong2    = 1 << 5; // 1100000_ 10______
+        inline static constexpr UInt8 TooLarge1000 = 1 << 6; // 11110101+ 1000____
+        inline static constexpr UInt8 Overlong4    = 1 << 6; // 11110000 1000____
+        inline static constexpr UInt8 TwoConts     = 1 << 7; // 10______ 10______
+        inline static constexpr UInt8 Carry        = TooShort | TooLong | TwoConts;
+
+        inline static constexpr UInt8 Byte1High[16] = {
+            // 0_______: ASCII
+            TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+            // 10______: continuation
+            TwoConts, TwoConts, TwoConts, TwoConts,
+            // 1100____, 1101____: two-byte lead
+            TooShort | Overlong2, TooShort,
+            // 1110____: three-byte lead
+            TooShort | Overlong3 | Surrogate,
+            // 1111____: four-byte lead
+            TooShort | TooLarge | TooLarge1000 | Overlong4
+        };
+
+        inline static constexpr UInt8 Byte1Low[16] = {
+            Carry | Overlong3 | Overlong2 | Overlong4, // ____0000
+            Carry | Overlong2,                         // ____0001
+            Carry,                                     // ____0010
+            Carry,                                     // ____0011
+            Carry | TooLarge,                          // ____0100
+            Carry | TooLarge | TooLarge1000,           // ____0101
+            Carry | TooLarge | TooLarge1000,           // ____0110
+            Carry | TooLarge | TooLarge1000,           // ____0111
+            Carry | TooLarge | TooLarge1000,           // ____1000
+            Carry | TooLarge | TooLarge1000,           // ____1001
+            Carry | TooLarge | TooLarge1000,           // ____1010
+            Carry | TooLarge | TooLarge1000,           // ____1011
+            Carry | TooLarge | TooLarge1000,           // ____1100
+            Carry | TooLarge | TooLarge1000 | Surrogate, // ____1101
+            Carry | TooLarge | TooLarge1000,           // ____1110
+            Carry | TooLarge | TooLarge1000            // ____1111
+        };
+
+        inline static constexpr UInt8 Byte2High[16] = {
+            // 0_______: ASCII
+            TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+            // 1000____
+            TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+            // 1001____
+            TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+            // 101_____
+            TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+            TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+            // 11______: lead byte
+            TooShort, TooShort, TooShort, TooShort
+        };
+
+        Vector m_Error          = TOps::Zero();
+        Vector m_PrevInput      = TOps::Zero();
+        Vector m_PrevIncomplete = TOps::Zero();
+
+        //! \brief Get the errors of the block, taking the last 3 bytes of the previous block into account.
+        UN_FINLINE static Vector CheckBytes(Vector input, Vector prevInput) noexcept
+        {
+            const Vector prev1 = TOps::template Prev<1>(input, prevInput);
+            const Vector byte1High = TOps::Lookup(TOps::Table(Byte1High), TOps::HighNibbles(prev1));
+            const Vector byte1Low  = TOps::Lookup(TOps::Table(Byte1Low), TOps::And(prev1, TOps::Broadcast(0x0f)));
+            const Vector byte2High = TOps::Lookup(TOps::Table(Byte2High), TOps::HighNibbles(input));
+            const Vector specialCases = TOps::And(TOps::And(byte1High, byte1Low), byte2High);
+
+            // The high bit is set for the bytes that must be the 2nd or 3rd continuation byte,
+            // these are exactly the pairs that the tables classify as TwoConts.
+            const Vector prev2       = TOps::template Prev<2>(input, prevInput);
+            const Vector prev3       = TOps::template Prev<3>(input, prevInput);
+            const Vector isThirdByte  = TOps::SubSaturate(prev2, TOps::Broadcast(0xe0 - 0x80));
+            const Vector isFourthByte = TOps::SubSaturate(prev3, TOps::Broadcast(0xf0 - 0x80));
+            const Vector mustBe23Continuation = TOps::And(TOps::Or(isThirdByte, isFourthByte), TOps::Broadcast(0x80));
+
+            return TOps::Xor(mustBe23Continuation, specialCases);
+        }
+
+        //! \brief Get non-zero bytes if the block ends with an incomplete multibyte sequence.
+        UN_FINLINE static Vector CheckIncomplete(Vector input) noexcept
+        {
+            // A lead byte of an N-byte sequence in the last N-1 positions.
+            alignas(32) static constexpr UInt8 maxValues[32] = {
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+            };
+
+            return TOps::SubSaturate(input, TOps::Load(maxValues + 32 - TOps::Width));
+        }
+
+        UN_FINLINE void ProcessBlock(Vector input) noexcept
+        {
+            if (TOps::IsAscii(input))
+            {
+                // An ASCII block can't complete a sequence started in the previous block.
+                m_Error = TOps::Or(m_Error, m_PrevIncomplete);
+            }
+            else
+            {
+                m_Error          = TOps::Or(m_Error, CheckBytes(input, m_PrevInput));
+                m_PrevIncomplete = CheckIncomplete(input);
+            }
+
+            m_PrevInput = input;
+        }
+
+    public:
+        inline static bool Validate(const UInt8* pData, USize length) noexcept
+        {
+            Utf8Validator validator;
+
+            USize index = 0;
+            for (; index + TOps::Width <= length; index += TOps::Width)
+            {
+                validator.ProcessBlock(TOps::Load(pData + index));
+            }
+
+            if (index < length)
+            {
+                // Zero padding is valid ASCII, so the tail can be processed as a full block.
+                UInt8 tail[TOps::Width] = {};
+                memcpy(tail, pData + index, length - index);
+                validator.ProcessBlock(TOps::Load(tail));
+            }
+
+            return TOps::IsZero(TOps::Or(validator.m_Error, validator.m_PrevIncomplete));
+        }
+    };
+#endif
+
+    //! \brief Check if the bytes are valid UTF-8.
+    //!
+    //! Uses AVX2 or SSE4.1 if enabled at compile time, the scalar validator otherwise.
+    inline bool SimdValidate(const UInt8* pData, USize length) noexcept
+    {
+#if UN_AVX2_SUPPORTED
+        return Utf8Validator<Avx2Utf8Ops>::Validate(pData, length);
+#elif UN_SSE41_SUPPORTED
+        return Utf8Validator<Sse41Utf8Ops>::Validate(pData, length);
+#else
+        return ValidateScalar(pData, length);
+#endif
+    }
+
+    template<class TOps>
+    UN_FINLINE USize CountCodepointBlocks(const UInt8* pData, USize& index, USize length) noexcept
+    {
+        USize result = 0;
+        for (; index + TOps::Width <= length; index += TOps::Width)
+        {
+            result += Bits::PopCount(TOps::StartMask(TOps::Load(pData + index)));
+        }
+
+        return result;
+    }
+
+    //! \brief Count the codepoints by counting the bytes that are not continuation bytes.
+    //!
+    //! Uses AVX2 if it was enabled at compile time, SSE2 otherwise. The input is not validated.
+    inline USize SimdCountCodepoints(const UInt8* pData, USize length) noexcept
+    {
+        USize result = 0;
+        USize index  = 0;
+#if UN_AVX2_SUPPORTED
+        result += CountCodepointBlocks<Avx2Utf8Ops>(pData, index, length);
+#endif
+        result += CountCodepointBlocks<Sse2Utf8Ops>(pData, index, length);
+
+        for (; index < length; ++index)
+        {
+            result += IsCodepointStart(pData[index]);
+        }
+
+        return result;
+    }
+
+    template<class TOps>
+    UN_FINLINE void SkipCodepointBlocks(const UInt8* pData, USize& index, USize length, USize& count) noexcept
+    {
+        for (; index + TOps::Width <= length; index += TOps::Width)
+        {
+            // Stop at the block that contains the codepoint we are looking for.
+            const UInt32 starts = Bits::PopCount(TOps::StartMask(TOps::Load(pData + index)));
+            if (starts > count)
+            {
+                return;
+            }
+
+            count -= starts;
+        }
+    }
+
+    //! \brief Get the byte offset of the codepoint that follows count codepoints, or length if there are fewer.
+    //!
+    //! Skips whole blocks of bytes while they contain fewer codepoint starts than there are left to skip.
+    //! Uses AVX2 if it was enabled at compile time, SSE2 otherwise. The input is not validated.
+    inline USize SimdSkipCodepoints(const UInt8* pData, USize length, USize count) noexcept
+    {
+        USize index = 0;
+#if UN_AVX2_SUPPORTED
+        SkipCodepointBlocks<Avx2Utf8Ops>(pData, index, length, count);
+#endif
+        SkipCodepointBlocks<Sse2Utf8Ops>(pData, index, length, count);
+
+        for (; index < length; ++index)
+        {
+            if (IsCodepointStart(pData[index]))
+            {
+                if (count == 0)
+                {
+                    break;
+                }
+
+                --count;
+            }
+        }
+
+        return index;
+    }
+} // namespace UN::UTF8::Internal
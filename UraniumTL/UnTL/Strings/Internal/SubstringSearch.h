@@ -0,0 +1,458 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Containers/Internal/SimdSearch.h>
+#include <UnTL/Utils/BitUtils.h>
+#include <algorithm>
+
+namespace UN::Internal
+{
+    //! \brief Needles up to this length are searched with the SIMD first/last byte filter, longer ones with Two-Way.
+    inline constexpr USize SimdSubstringMaxNeedle = 32;
+
+    //! \brief The SIMD filter verifies candidates with memcmp, after it has verified more than this number of bytes
+    //!        per scanned haystack byte (plus a constant allowance) the search switches to Two-Way.
+    //!
+    //! Verification of a candidate is bounded by the needle length, so the filter is linear on its own, but
+    //! a haystack like "aaaa...a" searched for "aa...ab" would make every position a candidate. The budget keeps
+    //! the worst case close to the Two-Way speed and doesn't affect realistic inputs.
+    inline constexpr USize SimdSubstringWorkPerByte = 4;
+    inline constexpr USize SimdSubstringWorkAllowance = 1024;
+
+    //! \brief Two-Way string matching algorithm by Crochemore and Perrin.
+    //!
+    //! Runs in O(n + m) time and O(1) extra space (the last byte shift table has a fixed size). The needle is
+    //! split at a critical factorization: the right part is matched left-to-right, then the left part right-to-left.
+    //! For periodic needles the already matched prefix is remembered after shifting by the period, so no haystack
+    //! byte is compared more than twice. A Horspool-style last byte shift is added to skip windows quickly.
+    //!
+    //! \tparam TReverse - If true, both the needle and the haystack are read from the end, which finds the last
+    //!                    occurrence. Positions are then counted from the end of the haystack.
+    template<bool TReverse>
+    class TwoWaySearcher final
+    {
+        const UInt8* m_pNeedle;
+        USize m_Length;
+        USize m_Split;
+        USize m_Period;
+        USize m_Memory;
+        UInt64 m_ByteSet[4] = {};
+        USize m_Shift[256];
+
+        [[nodiscard]] UN_FINLINE UInt8 NeedleAt(USize index) const noexcept
+        {
+            if constexpr (TReverse)
+                return m_pNeedle[m_Length - 1 - index];
+            else
+                return m_pNeedle[index];
+        }
+
+        //! \brief Compute the maximal suffix of the needle, the result is the index before the suffix and its period.
+        inline void MaximalSuffix(bool invertOrder, USize& split, USize& period) const noexcept
+        {
+            // The index before the suffix is -1 for the whole needle, the arithmetic below wraps around as intended.
+            USize ip = static_cast<USize>(-1);
+            USize jp = 0;
+            USize k  = 1;
+            USize p  = 1;
+            while (jp + k < m_Length)
+            {
+                const UInt8 a = NeedleAt(ip + k);
+                const UInt8 b = NeedleAt(jp + k);
+                if (a == b)
+                {
+                    if (k == p)
+                    {
+                        jp += p;
+                        k = 1;
+                    }
+                    else
+                    {
+                        ++k;
+                    }
+                }
+                else if ((a > b) != invertOrder)
+                {
+                    jp += k;
+                    k = 1;
+                    p = jp - ip;
+                }
+                else
+                {
+                    ip = jp++;
+                    k = p = 1;
+                }
+            }
+
+            split  = ip;
+            period = p;
+        }
+
+    public:
+        inline TwoWaySearcher(const UInt8* pNeedle, USize length) noexcept
+            : m_pNeedle(pNeedle)
+            , m_Length(length)
+        {
+            UN_Assert(length > 0, "Needle can't be empty");
+
+            // Only the entries of the bytes from the byte set are initialized and read.
+            for (USize i = 0; i < length; ++i)
+            {
+                const UInt8 byte = NeedleAt(i);
+                m_ByteSet[byte >> 6] |= UInt64(1) << (byte & 63);
+                m_Shift[byte] = i + 1;
+            }
+
+            USize split, period, invertedSplit, invertedPeriod;
+            MaximalSuffix(false, split, period);
+            MaximalSuffix(true, invertedSplit, invertedPeriod);
+            if (invertedSplit + 1 > split + 1)
+            {
+                split  = invertedSplit;
+                period = invertedPeriod;
+            }
+
+            bool periodic = true;
+            for (USize i = 0; i < split + 1; ++i)
+            {
+                if (NeedleAt(i) != NeedleAt(i + period))
+                {
+                    periodic = false;
+                    break;
+                }
+            }
+
+            m_Split = split;
+            if (periodic)
+            {
+                m_Period = period;
+                m_Memory = length - period;
+            }
+            else
+            {
+                // The left part is shorter than the period here, so the split is never -1.
+                m_Period = std::max(split, length - split - 1) + 1;
+                m_Memory = 0;
+            }
+        }
+
+        //! \brief Find the first occurrence of the needle at or after the start position.
+        //!
+        //! \return The position of the occurrence or -1 if not found.
+        [[nodiscard]] inline SSize Find(const UInt8* pHaystack, USize haystackLength, USize start) const noexcept
+        {
+            const auto haystackAt = [pHaystack, haystackLength](USize index) {
+                if constexpr (TReverse)
+                    return pHaystack[haystackLength - 1 - index];
+                else
+                    return pHaystack[index];
+            };
+
+            const USize length = m_Length;
+            USize memory       = 0;
+            USize position     = start;
+            while (position <= haystackLength && haystackLength - position >= length)
+            {
+                const UInt8 lastByte = haystackAt(position + length - 1);
+                if ((m_ByteSet[lastByte >> 6] & (UInt64(1) << (lastByte & 63))) == 0)
+                {
+                    position += length;
+                    memory = 0;
+                    continue;
+                }
+
+                const USize shift = length - m_Shift[lastByte];
+                if (shift != 0)
+                {
+                    position += shift;
+                    memory = 0;
+                    continue;
+                }
+
+                USize k = std::max(m_Split + 1, memory);
+                while (k < length && NeedleAt(k) == haystackAt(position + k))
+                {
+                    ++k;
+                }
+
+                if (k < length)
+                {
+                    position += k - m_Split;
+                    memory = 0;
+                    continue;
+                }
+
+                k = m_Split + 1;
+                while (k > memory && NeedleAt(k - 1) == haystackAt(position + k - 1))
+                {
+                    --k;
+                }
+
+                if (k <= memory)
+                {
+                    return static_cast<SSize>(position);
+                }
+
+                position += m_Period;
+                memory = m_Memory;
+            }
+
+            return -1;
+        }
+    };
+
+    //! \brief Check the candidate positions of a block of the haystack for matches of the whole needle.
+    //!
+    //! A position is a candidate if both the first and the last byte of the needle match, the bytes in between
+    //! are compared with memcmp. The loop stops early if the verification budget was exceeded.
+    template<class TOps>
+    UN_FINLINE SSize SimdFilterFindBlocks(const UInt8* pHaystack, USize& index, USize candidateCount, const UInt8* pNeedle,
+                                          USize needleLength, USize& work)
+    {
+        const auto first = TOps::Broadcast(pNeedle[0]);
+        const auto last  = TOps::Broadcast(pNeedle[needleLength - 1]);
+        for (; index + TOps::Width <= candidateCount; index += TOps::Width)
+        {
+            if (work > index * SimdSubstringWorkPerByte + SimdSubstringWorkAllowance)
+            {
+                break;
+            }
+
+            UInt32 mask = TOps::template Match<UInt8>(TOps::Load(pHaystack + index), first)
+                & TOps::template Match<UInt8>(TOps::Load(pHaystack + index + needleLength - 1), last);
+            for (; mask != 0; mask = Bits::ResetLowestSetBit(mask))
+            {
+                const USize candidate = index + Bits::CountTrailingZeros(mask);
+                if (memcmp(pHaystack + candidate + 1, pNeedle + 1, needleLength - 2) == 0)
+                {
+                    return static_cast<SSize>(candidate);
+                }
+
+                work += needleLength;
+            }
+        }
+
+        return -1;
+    }
+
+    //! \brief Same as SimdFilterFindBlocks, but scans the blocks from the end, index is the number of unscanned candidates.
+    template<class TOps>
+    UN_FINLINE SSize SimdFilterFindLastBlocks(const UInt8* pHaystack, USize& index, USize candidateCount,
+                                              const UInt8* pNeedle, USize needleLength, USize& work)
+    {
+        const auto first = TOps::Broadcast(pNeedle[0]);
+        const auto last  = TOps::Broadcast(pNeedle[needleLength - 1]);
+        for (; index >= TOps::Width; index -= TOps::Width)
+        {
+            if (work > (candidateCount - index) * SimdSubstringWorkPerByte + SimdSubstringWorkAllowance)
+            {
+                break;
+            }
+
+            const USize base = index - TOps::Width;
+            UInt32 mask      = TOps::template Match<UInt8>(TOps::Load(pHaystack + base), first)
+                & TOps::template Match<UInt8>(TOps::Load(pHaystack + base + needleLength - 1), last);
+            while (mask != 0)
+            {
+                const UInt32 bit      = 31 - Bits::CountLeadingZeros(mask);
+                const USize candidate = base + bit;
+                if (memcmp(pHaystack + candidate + 1, pNeedle + 1, needleLength - 2) == 0)
+                {
+                    return static_cast<SSize>(candidate);
+                }
+
+                mask &= ~(UInt32(1) << bit);
+                work += needleLength;
+            }
+        }
+
+        return -1;
+    }
+
+    //! \brief Find the first occurrence of a byte string.
+    //!
+    //! Single bytes are searched with SimdFindFirstOf. Needles up to SimdSubstringMaxNeedle bytes are found with
+    //! a SIMD filter that compares the first and the last byte of the needle at 16 or 32 positions at once; if the
+    //! filter produces too many false candidates, the rest of the haystack is searched with Two-Way. Longer needles
+    //! always use Two-Way. The running time is O(n + m) in all cases.
+    //!
+    //! \return The index of the occurrence or -1 if not found. An empty needle is found at index 0.
+    inline SSize FindSubstring(const char* pHaystack, USize haystackLength, const char* pNeedle, USize needleLength) noexcept
+    {
+        if (needleLength == 0)
+        {
+            return 0;
+        }
+
+        if (needleLength > haystackLength)
+        {
+            return -1;
+        }
+
+        if (needleLength == 1)
+        {
+            return SimdFindFirstOf(pHaystack, haystackLength, pNeedle[0]);
+        }
+
+        const auto* pHaystackBytes = reinterpret_cast<const UInt8*>(pHaystack);
+        const auto* pNeedleBytes   = reinterpret_cast<const UInt8*>(pNeedle);
+        if (needleLength <= SimdSubstringMaxNeedle)
+        {
+            const USize candidateCount = haystackLength - needleLength + 1;
+            USize index                = 0;
+            USize work                 = 0;
+            SSize result;
+#if UN_AVX2_SUPPORTED
+            result = SimdFilterFindBlocks<Avx2SearchOps>(pHaystackBytes, index, candidateCount, pNeedleBytes, needleLength, work);
+            if (result >= 0)
+            {
+                return result;
+            }
+#endif
+            result = SimdFilterFindBlocks<Sse2SearchOps>(pHaystackBytes, index, candidateCount, pNeedleBytes, needleLength, work);
+            if (result >= 0)
+            {
+                return result;
+            }
+
+            if (index + Sse2SearchOps::Width <= candidateCount)
+            {
+                // The budget was exceeded.
+                const TwoWaySearcher<false> searcher(pNeedleBytes, needleLength);
+                return searcher.Find(pHaystackBytes, haystackLength, index);
+            }
+
+            for (; index < candidateCount; ++index)
+            {
+                if (pHaystack[index] == pNeedle[0] && memcmp(pHaystack + index + 1, pNeedle + 1, needleLength - 1) == 0)
+                {
+                    return static_cast<SSize>(index);
+                }
+            }
+
+            return -1;
+        }
+
+        const TwoWaySearcher<false> searcher(pNeedleBytes, needleLength);
+        return searcher.Find(pHaystackBytes, haystackLength, 0);
+    }
+
+    //! \brief Find the last occurrence of a byte string, see FindSubstring.
+    //!
+    //! \return The index of the occurrence or -1 if not found. An empty needle is found at the end of the haystack.
+    inline SSize FindLastSubstring(const char* pHaystack, USize haystackLength, const char* pNeedle, USize needleLength) noexcept
+    {
+        if (needleLength == 0)
+        {
+            return static_cast<SSize>(haystackLength);
+        }
+
+        if (needleLength > haystackLength)
+        {
+            return -1;
+        }
+
+        if (needleLength == 1)
+        {
+            return SimdFindLastOf(pHaystack, haystackLength, pNeedle[0]);
+        }
+
+        const auto* pHaystackBytes = reinterpret_cast<const UInt8*>(pHaystack);
+        const auto* pNeedleBytes   = reinterpret_cast<const UInt8*>(pNeedle);
+        USize index                = haystackLength - needleLength + 1;
+        if (needleLength <= SimdSubstringMaxNeedle)
+        {
+            const USize candidateCount = index;
+            USize work                 = 0;
+            SSize result;
+#if UN_AVX2_SUPPORTED
+            result = SimdFilterFindLastBlocks<Avx2SearchOps>(pHaystackBytes, index, candidateCount, pNeedleBytes, needleLength,
+                                                             work);
+            if (result >= 0)
+            {
+                return result;
+            }
+#endif
+            result =
+                SimdFilterFindLastBlocks<Sse2SearchOps>(pHaystackBytes, index, candidateCount, pNeedleBytes, needleLength, work);
+            if (result >= 0)
+            {
+                return result;
+            }
+
+            if (index < Sse2SearchOps::Width)
+            {
+                while (index > 0)
+                {
+                    --index;
+                    if (pHaystack[index] == pNeedle[0] && memcmp(pHaystack + index + 1, pNeedle + 1, needleLength - 1) == 0)
+                    {
+                        return static_cast<SSize>(index);
+                    }
+                }
+
+                return -1;
+            }
+
+            // The budget was exceeded, search the unscanned candidates with Two-Way.
+        }
+
+        const USize prefixLength = index + needleLength - 1;
+        const TwoWaySearcher<true> searcher(pNeedleBytes, needleLength);
+        const SSize position = searcher.Find(pHaystackBytes, prefixLength, 0);
+        return position < 0 ? -1 : static_cast<SSize>(prefixLength - needleLength) - position;
+    }
+
+    //! \brief Call a function for the index of every non-overlapping occurrence of a byte string, in ascending order.
+    //!
+    //! Function signature:
+    //! \code{.cpp}
+    //!     void f(USize index);
+    //! \endcode
+    template<class TFunc>
+    inline void ForEachSubstring(const char* pHaystack, USize haystackLength, const char* pNeedle, USize needleLength,
+                                 TFunc&& f)
+    {
+        UN_Assert(needleLength > 0, "Needle can't be empty");
+        if (needleLength > haystackLength)
+        {
+            return;
+        }
+
+        if (needleLength == 1)
+        {
+            SimdForEachMatch(pHaystack, haystackLength, pNeedle[0], f);
+            return;
+        }
+
+        if (needleLength <= SimdSubstringMaxNeedle)
+        {
+            USize start = 0;
+            while (true)
+            {
+                const SSize index = FindSubstring(pHaystack + start, haystackLength - start, pNeedle, needleLength);
+                if (index < 0)
+                {
+                    return;
+                }
+
+                f(start + static_cast<USize>(index));
+                start += static_cast<USize>(index) + needleLength;
+            }
+        }
+
+        // Reuse the critical factorization and the shift table for all occurrences.
+        const TwoWaySearcher<false> searcher(reinterpret_cast<const UInt8*>(pNeedle), needleLength);
+        USize start = 0;
+        while (true)
+        {
+            const SSize index = searcher.Find(reinterpret_cast<const UInt8*>(pHaystack), haystackLength, start);
+            if (index < 0)
+            {
+                return;
+            }
+
+            f(static_cast<USize>(index));
+            start = static_cast<USize>(index) + needleLength;
+        }
+    }
+} // namespace UN::Internal
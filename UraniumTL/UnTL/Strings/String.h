@@ -2,10 +2,15 @@
 #include <UnTL/Base/Base.h>
 #include <UnTL/Containers/ArraySlice.h>
 #include <UnTL/Strings/StringSlice.h>
+#include <UnTL/Strings/Transcode.h>
 
 namespace UN
 {
-    //! \brief String class that uses HeapAllocator and UTF-8 encoding.
+    //! \brief String class that uses UTF-8 encoding.
+    //!
+    //! Long strings are allocated from the IAllocator passed to the constructor, or from SystemAllocator
+    //! if none was specified. The allocator must outlive the string. Moves and copy construction take
+    //! the allocator of the source string, copy assignment keeps the allocator of the destination.
     class String final
     {
         struct LongMode
@@ -45,6 +50,8 @@ namespace UN
             };
         } m_Data;
 
+        IAllocator* m_pAllocator = SystemAllocator::Get();
+
         [[nodiscard]] inline bool IsLong() const noexcept
         {
             return m_Data.S.Size & 1;
@@ -105,14 +112,19 @@ namespace UN
             return guess;
         }
 
-        inline static TChar* Allocate(size_t s) noexcept
+        inline TChar* Allocate(size_t s) noexcept
         {
-            return static_cast<TChar*>(SystemAllocator::Get()->Allocate(s, Alignment));
+            return static_cast<TChar*>(m_pAllocator->Allocate(s, Alignment));
         }
 
-        inline static void Deallocate(TChar* c) noexcept
+        inline void Deallocate(TChar* c, size_t s) noexcept
         {
-            SystemAllocator::Get()->Deallocate(c);
+            m_pAllocator->Deallocate(c, s, Alignment);
+        }
+
+        inline TChar* Reallocate(TChar* c, size_t s, size_t newS) noexcept
+        {
+            return static_cast<TChar*>(m_pAllocator->Reallocate(c, s, newS, Alignment));
         }
 
         inline static void CopyData(TChar* dest, const TChar* src, size_t size) noexcept
@@ -162,18 +174,34 @@ namespace UN
         inline void GrowAndReplace(size_t oldCap, size_t deltaCap, size_t oldSize, size_t copyCount, size_t delCount,
                                    size_t addCount, const TChar* newChars)
         {
-            TChar* oldData = Data();
-            size_t cap     = Recommend(std::max(oldCap + deltaCap, 2 * oldCap));
-            TChar* newData = Allocate(cap + 1);
-            if (copyCount)
-                CopyData(newData, oldData, copyCount);
-            if (addCount)
-                CopyData(newData + copyCount, newChars, addCount);
+            TChar* oldData  = Data();
+            size_t cap      = Recommend(std::max(oldCap + deltaCap, 2 * oldCap));
             size_t copySize = oldSize - delCount - copyCount;
-            if (copySize)
-                CopyData(newData + copyCount + addCount, oldData + delCount, copySize);
-            if (oldCap + 1 != MinCapacity)
-                Deallocate(oldData);
+            bool isLong     = oldCap + 1 != MinCapacity;
+            auto oldAddress = reinterpret_cast<USize>(oldData);
+            auto newAddress = reinterpret_cast<USize>(newChars);
+            bool aliased    = newAddress >= oldAddress && newAddress < oldAddress + oldCap + 1;
+
+            TChar* newData;
+            if (isLong && copySize == 0 && !aliased)
+            {
+                // Appending to a heap buffer: the allocator might be able to avoid a separate copy.
+                newData = Reallocate(oldData, oldCap + 1, cap + 1);
+                if (addCount)
+                    CopyData(newData + copyCount, newChars, addCount);
+            }
+            else
+            {
+                newData = Allocate(cap + 1);
+                if (copyCount)
+                    CopyData(newData, oldData, copyCount);
+                if (addCount)
+                    CopyData(newData + copyCount, newChars, addCount);
+                if (copySize)
+                    CopyData(newData + copyCount + addCount, oldData + delCount, copySize);
+                if (isLong)
+                    Deallocate(oldData, oldCap + 1);
+            }
             m_Data.L.Data = (newData);
             SetLCap(cap + 1);
             oldSize = copyCount + addCount + copySize;
@@ -249,6 +277,7 @@ namespace UN
         }
 
         inline String(const String& other) noexcept
+            : m_pAllocator(other.m_pAllocator)
         {
             if (!other.IsLong())
                 m_Data = other.m_Data;
@@ -269,6 +298,7 @@ namespace UN
 
         inline String(String&& other) noexcept
             : m_Data(other.m_Data)
+            , m_pAllocator(other.m_pAllocator)
         {
             other.Zero();
         }
@@ -277,11 +307,31 @@ namespace UN
         {
             Clear();
             Shrink();
-            m_Data = other.m_Data;
+            m_Data       = other.m_Data;
+            m_pAllocator = other.m_pAllocator;
             other.Zero();
             return *this;
         }
 
+        //! \brief Create an empty string that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        inline explicit String(IAllocator* pAllocator) noexcept
+            : m_pAllocator(pAllocator)
+        {
+            Zero();
+        }
+
+        //! \brief Create a string that uses the specified allocator.
+        //!
+        //! \param pAllocator - The allocator to use for heap allocations.
+        //! \param slice      - The string to copy the data from.
+        inline String(IAllocator* pAllocator, StringSlice slice) noexcept
+            : m_pAllocator(pAllocator)
+        {
+            Init(slice.Data(), slice.Size());
+        }
+
         inline String(size_t length, TChar value) noexcept
         {
             Init(length, value);
@@ -306,10 +356,16 @@ namespace UN
         {
             if (IsLong())
             {
-                Deallocate(m_Data.L.Data);
+                Deallocate(m_Data.L.Data, GetLCap());
             }
         }
 
+        //! \brief Get the allocator used by the string.
+        [[nodiscard]] inline IAllocator* GetAllocator() const noexcept
+        {
+            return m_pAllocator;
+        }
+
         [[nodiscard]] inline const TChar* Data() const noexcept
         {
             return IsLong() ? m_Data.L.Data : m_Data.S.Data;
@@ -378,8 +434,8 @@ namespace UN
         {
             auto begin = Data();
             auto end   = Data();
-            UTF8::Advance(begin, beginIndex);
-            UTF8::Advance(end, endIndex);
+            UTF8::Advance(begin, Data() + Size(), beginIndex);
+            UTF8::Advance(end, Data() + Size(), endIndex);
             return StringSlice(begin, end - begin);
         }
 
@@ -396,13 +452,18 @@ namespace UN
             if (cap >= reserve)
                 return;
 
-            reserve        = Recommend(reserve);
-            TChar* newData = Allocate(reserve + 1);
-            TChar* oldData = Data();
-            auto oldSize   = Size();
-            CopyData(newData, oldData, oldSize + 1);
+            reserve      = Recommend(reserve);
+            auto oldSize = Size();
+            TChar* newData;
             if (IsLong())
-                Deallocate(oldData);
+            {
+                newData = Reallocate(m_Data.L.Data, cap + 1, reserve + 1);
+            }
+            else
+            {
+                newData = Allocate(reserve + 1);
+                CopyData(newData, m_Data.S.Data, oldSize + 1);
+            }
 
             SetLCap(reserve + 1);
             SetLSize(oldSize);
@@ -423,7 +484,7 @@ namespace UN
                 TChar* oldData = m_Data.L.Data;
 
                 CopyData(newData, oldData, size + 1);
-                Deallocate(oldData);
+                Deallocate(oldData, cap + 1);
                 SetSSize(size);
             }
             else
@@ -432,7 +493,7 @@ namespace UN
                 TChar* oldData = m_Data.L.Data;
 
                 CopyData(newData, oldData, size + 1);
-                Deallocate(oldData);
+                Deallocate(oldData, cap + 1);
 
                 SetLCap(reserve + 1);
                 SetLSize(size);
@@ -500,7 +561,7 @@ namespace UN
 
         inline friend String operator+(const String& lhs, StringSlice rhs)
         {
-            String t;
+            String t(lhs.m_pAllocator);
             t.Reserve(lhs.Size() + rhs.Size() + 1);
             t += lhs;
             t += rhs;
@@ -509,7 +570,7 @@ namespace UN
 
         inline friend String operator/(const String& lhs, StringSlice rhs)
         {
-            String t;
+            String t(lhs.m_pAllocator);
             t.Reserve(lhs.Size() + rhs.Size() + 2);
             t += lhs;
             t /= rhs;
@@ -531,14 +592,114 @@ namespace UN
             return StringSlice(Data(), Size()).FindLastOf(search).m_Iter;
         }
 
-        [[nodiscard]] inline List<StringSlice> Split(TCodepoint c = ' ') const
+        [[nodiscard]] inline SSize Find(StringSlice search, USize startIndex = 0) const noexcept
+        {
+            return StringSlice(Data(), Size()).Find(search, startIndex);
+        }
+
+        [[nodiscard]] inline SSize FindLast(StringSlice search) const noexcept
+        {
+            return StringSlice(Data(), Size()).FindLast(search);
+        }
+
+        [[nodiscard]] inline USize Count(StringSlice search) const noexcept
+        {
+            return StringSlice(Data(), Size()).Count(search);
+        }
+
+        [[nodiscard]] inline bool Contains(StringSlice search) const noexcept
+        {
+            return StringSlice(Data(), Size()).Contains(search);
+        }
+
+        //! \brief Replace the first occurrence of a non-empty substring.
+        //!
+        //! The arguments can point into this string.
+        //!
+        //! \return True if the substring was found.
+        inline bool Replace(StringSlice search, StringSlice replacement)
+        {
+            UN_Assert(search.Size() > 0, "Can't replace an empty substring");
+            const SSize index = Find(search);
+            if (index < 0)
+            {
+                return false;
+            }
+
+            const auto matchIndex = static_cast<USize>(index);
+            String result(m_pAllocator);
+            result.Reserve(Size() - search.Size() + replacement.Size());
+            result.Append(Data(), matchIndex);
+            result.Append(replacement);
+            result.Append(Data() + matchIndex + search.Size(), Size() - matchIndex - search.Size());
+            *this = std::move(result);
+            return true;
+        }
+
+        //! \brief Replace all non-overlapping occurrences of a non-empty substring, scanning from the beginning.
+        //!
+        //! The string is scanned once and rebuilt only if the substring was found. The arguments can point into this string.
+        //!
+        //! \return The number of replaced occurrences.
+        inline USize ReplaceAll(StringSlice search, StringSlice replacement)
+        {
+            UN_Assert(search.Size() > 0, "Can't replace an empty substring");
+            String result(m_pAllocator);
+            USize partBegin = 0;
+            USize count     = 0;
+            Internal::ForEachSubstring(Data(), Size(), search.Data(), search.Size(), [&](USize index) {
+                if (count++ == 0)
+                {
+                    result.Reserve(replacement.Size() > search.Size() ? Size() + Size() / 2 : Size());
+                }
+
+                result.Append(Data() + partBegin, index - partBegin);
+                result.Append(replacement);
+                partBegin = index + search.Size();
+            });
+
+            if (count > 0)
+            {
+                result.Append(Data() + partBegin, Size() - partBegin);
+                *this = std::move(result);
+            }
+
+            return count;
+        }
+
+        template<class TList = List<StringSlice>>
+        [[nodiscard]] inline TList Split(TCodepoint c = ' ') const
+        {
+            return StringSlice(Data(), Size()).template Split<TList>(c);
+        }
+
+        template<class TList = List<StringSlice>>
+        [[nodiscard]] inline TList Split(StringSlice separator) const
+        {
+            return StringSlice(Data(), Size()).template Split<TList>(separator);
+        }
+
+        template<class TList = List<StringSlice>>
+        [[nodiscard]] inline TList SplitLines() const
+        {
+            return StringSlice(Data(), Size()).template SplitLines<TList>();
+        }
+
+        [[nodiscard]] inline StringSplitRange SplitIter(TCodepoint separator = ' ', SplitOptions options = SplitOptions::None,
+                                                        USize maxSplits = std::numeric_limits<USize>::max()) const noexcept
+        {
+            return StringSlice(Data(), Size()).SplitIter(separator, options, maxSplits);
+        }
+
+        [[nodiscard]] inline StringSplitRange SplitIter(StringSlice separator, SplitOptions options = SplitOptions::None,
+                                                        USize maxSplits = std::numeric_limits<USize>::max()) const noexcept
         {
-            return StringSlice(Data(), Size()).Split(c);
+            return StringSlice(Data(), Size()).SplitIter(separator, options, maxSplits);
         }
 
-        [[nodiscard]] inline List<StringSlice> SplitLines() const
+        [[nodiscard]] inline StringSplitRange LinesIter(SplitOptions options = SplitOptions::None) const noexcept
         {
-            return StringSlice(Data(), Size()).SplitLines();
+            return StringSlice(Data(), Size()).LinesIter(options);
         }
 
         [[nodiscard]] inline StringSlice StripRight(StringSlice chars = "\n\r\t ") const noexcept
@@ -594,13 +755,11 @@ namespace UN
 
         [[nodiscard]] inline WString ToWideString() const
         {
+            // wchar_t is UTF-16 on Windows and UTF-32 on other platforms.
+            const auto* pData = reinterpret_cast<const UInt8*>(Data());
             WString result;
-            result.reserve(Length());
-            for (TCodepoint cp : *this)
-            {
-                result += static_cast<wchar_t>(cp);
-            }
-
+            result.resize(sizeof(wchar_t) == 2 ? UTF8::Internal::CountUtf16Units(pData, Size()) : Length());
+            result.resize(UTF8::Internal::Utf8ToUnits(pData, Size(), result.data(), result.size()));
             return result;
         }
 
@@ -645,6 +804,11 @@ namespace UN
         }
     };
 
+    template<>
+    struct IsTriviallyRelocatable<String> : std::true_type
+    {
+    };
+
     template<>
     struct ValueParser<String> : std::true_type
     {
@@ -661,7 +825,11 @@ namespace std
     template<>
     struct hash<UN::String>
     {
-        inline size_t operator()(const UN::String& str) const noexcept
+        //! Lets UN::HashMap and UN::HashSet find UN::String keys by UN::StringSlice. The hash of a String is
+        //! always equal to the hash of the corresponding StringSlice.
+        using is_transparent = void;
+
+        inline size_t operator()(UN::StringSlice str) const noexcept
         {
             std::hash<std::string_view> hasher;
             return hasher(std::string_view(str.Data(), str.Size()));
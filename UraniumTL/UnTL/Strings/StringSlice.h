@@ -1,10 +1,11 @@
 #pragma once
+#include <UnTL/Base/Flags.h>
 #include <UnTL/Containers/List.h>
+#include <UnTL/Strings/Internal/SubstringSearch.h>
 #include <UnTL/Strings/Unicode.h>
 #include <UnTL/Utils/Result.h>
 #include <cassert>
-#include <codecvt>
-#include <locale>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <type_traits>
@@ -79,6 +80,18 @@ namespace UN
     {
     };
 
+    //! \brief Options for lazy string splitting, see StringSlice::SplitIter.
+    enum class SplitOptions : UInt32
+    {
+        None                = 0,
+        SkipEmpty           = UN_BIT(0), //!< Don't produce empty parts, e.g. between consecutive separators.
+        StripCarriageReturn = UN_BIT(1), //!< Remove trailing '\r' characters from the parts.
+    };
+
+    UN_ENUM_OPERATORS(SplitOptions);
+
+    class StringSplitRange;
+
     //! \brief A slice of String.
     class StringSlice final
     {
@@ -238,6 +251,56 @@ namespace UN
             };
         };
 
+    private:
+        [[nodiscard]] inline bool IsEncodedAt(const TChar* pMatch, const TChar* pEncoded, USize encodedSize) const noexcept
+        {
+            return encodedSize <= static_cast<USize>(Data() + Size() - pMatch)
+                && memcmp(pMatch + 1, pEncoded + 1, encodedSize - 1) == 0;
+        }
+
+        //! \brief Call a function for every part of the string between the separators, see Split.
+        template<class TFunc>
+        inline void ForEachPart(TCodepoint separator, TFunc&& f) const
+        {
+            TChar encoded[4];
+            const USize encodedSize = UTF8::Encode(separator, encoded);
+
+            USize partBegin = 0;
+            if (encodedSize > 0)
+            {
+                Internal::SimdForEachMatch(Data(), Size(), encoded[0], [&](USize index) {
+                    // The lead byte can't be a part of the previous separator, the other bytes of which are continuation bytes.
+                    if (IsEncodedAt(Data() + index, encoded, encodedSize))
+                    {
+                        f(StringSlice(Data() + partBegin, index - partBegin));
+                        partBegin = index + encodedSize;
+                    }
+                });
+            }
+
+            if (partBegin < Size())
+            {
+                f(StringSlice(Data() + partBegin, Size() - partBegin));
+            }
+        }
+
+        //! \brief Call a function for every part of the string between the separator substrings, see Split.
+        template<class TFunc>
+        inline void ForEachPart(StringSlice separator, TFunc&& f) const
+        {
+            USize partBegin = 0;
+            Internal::ForEachSubstring(Data(), Size(), separator.Data(), separator.Size(), [&](USize index) {
+                f(StringSlice(Data() + partBegin, index - partBegin));
+                partBegin = index + separator.Size();
+            });
+
+            if (partBegin < Size())
+            {
+                f(StringSlice(Data() + partBegin, Size() - partBegin));
+            }
+        }
+
+    public:
         inline constexpr StringSlice() noexcept
             : m_Data(nullptr)
             , m_Size(0)
@@ -295,8 +358,8 @@ namespace UN
         {
             auto begin = Data();
             auto end   = Data();
-            UTF8::Advance(begin, beginIndex);
-            UTF8::Advance(end, endIndex);
+            UTF8::Advance(begin, Data() + Size(), beginIndex);
+            UTF8::Advance(end, Data() + Size(), endIndex);
             return StringSlice(begin, end - begin);
         }
 
@@ -323,17 +386,39 @@ namespace UN
             return 0;
         }
 
+        //! \brief Find the first occurrence of a codepoint starting from an iterator.
+        //!
+        //! The codepoint is encoded once and searched for as bytes with SIMD: UTF-8 is self-synchronizing,
+        //! so a match of the whole encoded sequence always starts at a codepoint boundary.
         [[nodiscard]] inline Iterator FindFirstOf(Iterator start, TCodepoint search) const noexcept
         {
-            auto e = end();
-            for (auto iter = start; iter != e; ++iter)
+            TChar encoded[4];
+            const USize encodedSize = UTF8::Encode(search, encoded);
+            const TChar* pEnd       = Data() + Size();
+            if (encodedSize == 0)
             {
-                if (*iter == search)
+                return pEnd;
+            }
+
+            const TChar* pCurrent = start.m_Iter;
+            while (pCurrent < pEnd)
+            {
+                const SSize index = Internal::SimdFindFirstOf(pCurrent, static_cast<USize>(pEnd - pCurrent), encoded[0]);
+                if (index < 0)
+                {
+                    break;
+                }
+
+                const TChar* pMatch = pCurrent + index;
+                if (IsEncodedAt(pMatch, encoded, encodedSize))
                 {
-                    return iter;
+                    return pMatch;
                 }
+
+                pCurrent = pMatch + 1;
             }
-            return e;
+
+            return pEnd;
         }
 
         [[nodiscard]] inline Iterator FindFirstOf(TCodepoint search) const noexcept
@@ -341,18 +426,36 @@ namespace UN
             return FindFirstOf(begin(), search);
         }
 
+        //! \brief Find the last occurrence of a codepoint, see FindFirstOf.
         [[nodiscard]] inline Iterator FindLastOf(TCodepoint search) const noexcept
         {
-            auto e      = end();
-            auto result = e;
-            for (auto iter = begin(); iter != e; ++iter)
+            TChar encoded[4];
+            const USize encodedSize = UTF8::Encode(search, encoded);
+            const TChar* pEnd       = Data() + Size();
+            if (encodedSize == 0)
             {
-                if (*iter == search)
+                return pEnd;
+            }
+
+            USize length = Size();
+            while (length > 0)
+            {
+                const SSize index = Internal::SimdFindLastOf(Data(), length, encoded[0]);
+                if (index < 0)
                 {
-                    result = iter;
+                    break;
                 }
+
+                const TChar* pMatch = Data() + index;
+                if (IsEncodedAt(pMatch, encoded, encodedSize))
+                {
+                    return pMatch;
+                }
+
+                length = static_cast<USize>(index);
             }
-            return result;
+
+            return pEnd;
         }
 
         [[nodiscard]] inline bool Contains(TCodepoint search) const noexcept
@@ -360,6 +463,48 @@ namespace UN
             return FindFirstOf(search) != end();
         }
 
+        //! \brief Find the first occurrence of a substring.
+        //!
+        //! Short substrings are found with a SIMD filter on their first and last bytes, long ones with the Two-Way
+        //! algorithm, the search is linear in the size of the string in both cases. A match of valid UTF-8 always
+        //! starts at a codepoint boundary.
+        //!
+        //! \param search     - The substring to find.
+        //! \param startIndex - The byte index to start the search from.
+        //!
+        //! \return The byte index of the occurrence or -1 if not found. An empty substring is found at startIndex.
+        [[nodiscard]] inline SSize Find(StringSlice search, USize startIndex = 0) const noexcept
+        {
+            UN_Assert(startIndex <= Size(), "Index out of range");
+            const SSize index = Internal::FindSubstring(Data() + startIndex, Size() - startIndex, search.Data(), search.Size());
+            return index < 0 ? index : index + static_cast<SSize>(startIndex);
+        }
+
+        //! \brief Find the last occurrence of a substring, see Find.
+        //!
+        //! \return The byte index of the occurrence or -1 if not found. An empty substring is found at Size().
+        [[nodiscard]] inline SSize FindLast(StringSlice search) const noexcept
+        {
+            return Internal::FindLastSubstring(Data(), Size(), search.Data(), search.Size());
+        }
+
+        //! \brief Count non-overlapping occurrences of a non-empty substring.
+        [[nodiscard]] inline USize Count(StringSlice search) const noexcept
+        {
+            UN_Assert(search.Size() > 0, "Can't count empty substrings");
+            USize result = 0;
+            Internal::ForEachSubstring(Data(), Size(), search.Data(), search.Size(), [&result](USize) {
+                ++result;
+            });
+
+            return result;
+        }
+
+        [[nodiscard]] inline bool Contains(StringSlice search) const noexcept
+        {
+            return Find(search) >= 0;
+        }
+
         [[nodiscard]] inline bool StartsWith(StringSlice prefix, bool caseSensitive = true) const noexcept
         {
             if (prefix.Size() > Size())
@@ -380,39 +525,69 @@ namespace UN
             return UTF8::AreEqual(Data() + Size() - suffix.Size(), suffix.Data(), suffix.Size(), suffix.Size(), caseSensitive);
         }
 
-        [[nodiscard]] inline List<StringSlice> Split(TCodepoint c = ' ') const
+        //! \brief Split the string by a separator codepoint, the separators are not included.
+        //!
+        //! Consecutive separators produce empty parts, a separator at the end doesn't. The string is scanned
+        //! once for the first byte of the separator with SIMD.
+        template<class TList = List<StringSlice>>
+        [[nodiscard]] inline TList Split(TCodepoint c = ' ') const
         {
-            List<StringSlice> result;
-            auto current = begin();
-            while (current != end())
-            {
-                auto cPos = FindFirstOf(current, c);
-                result.Emplace(current.m_Iter, cPos.m_Iter - current.m_Iter);
-                current = cPos;
-                if (current != end())
-                {
-                    ++current;
-                }
-            }
+            TList result;
+            ForEachPart(c, [&result](StringSlice part) {
+                result.Emplace(part);
+            });
 
             return result;
         }
 
-        [[nodiscard]] inline List<StringSlice> SplitLines() const
+        //! \brief Split the string by a non-empty separator substring, see Split(TCodepoint).
+        template<class TList = List<StringSlice>>
+        [[nodiscard]] inline TList Split(StringSlice separator) const
         {
-            List<StringSlice> result;
-            auto current = begin();
-            while (current != end())
-            {
-                auto cPos = FindFirstOf(current, '\n');
-                auto line = StringSlice(current.m_Iter, cPos.m_Iter - current.m_Iter).StripRight("\r");
-                result.Emplace(line);
-                current = cPos;
-                if (current != end())
+            UN_Assert(separator.Size() > 0, "Separator can't be empty");
+            TList result;
+            ForEachPart(separator, [&result](StringSlice part) {
+                result.Emplace(part);
+            });
+
+            return result;
+        }
+
+        //! \brief Lazily split the string by a separator codepoint.
+        //!
+        //! Unlike Split, the parts are found one by one while iterating and nothing is allocated, so only the
+        //! used part of the string is scanned. Without options the parts are the same as the ones from Split.
+        //!
+        //! \param separator - The separator codepoint.
+        //! \param options   - Split options.
+        //! \param maxSplits - The maximum number of parts ending at a separator, the rest of the string is returned
+        //!                    as the last part.
+        [[nodiscard]] inline StringSplitRange SplitIter(TCodepoint separator = ' ', SplitOptions options = SplitOptions::None,
+                                                        USize maxSplits = std::numeric_limits<USize>::max()) const noexcept;
+
+        //! \brief Lazily split the string by a non-empty separator substring, see SplitIter(TCodepoint).
+        //!
+        //! The separator must outlive the range.
+        [[nodiscard]] inline StringSplitRange SplitIter(StringSlice separator, SplitOptions options = SplitOptions::None,
+                                                        USize maxSplits = std::numeric_limits<USize>::max()) const noexcept;
+
+        //! \brief Lazily split the string by '\n', trailing '\r' characters are removed from the lines.
+        [[nodiscard]] inline StringSplitRange LinesIter(SplitOptions options = SplitOptions::None) const noexcept;
+
+        //! \brief Split the string by '\n', trailing '\r' characters are removed from the lines.
+        template<class TList = List<StringSlice>>
+        [[nodiscard]] inline TList SplitLines() const
+        {
+            TList result;
+            ForEachPart('\n', [&result](StringSlice line) {
+                USize size = line.Size();
+                while (size > 0 && line.Data()[size - 1] == '\r')
                 {
-                    ++current;
+                    --size;
                 }
-            }
+
+                result.Emplace(line.Data(), size);
+            });
 
             return result;
         }
@@ -506,6 +681,208 @@ namespace UN
         }
     };
 
+    //! \brief A lazy range of the parts of a string between separators, see StringSlice::SplitIter.
+    //!
+    //! The iterators point to the range, which must outlive them, e.g. in range-for the range is kept alive
+    //! for the whole loop. Both the range and the iterators point into the split string.
+    class StringSplitRange final
+    {
+        StringSlice m_String;
+        const TChar* m_pSeparator;
+        USize m_SeparatorSize;
+        TChar m_EncodedSeparator[4];
+        SplitOptions m_Options;
+        USize m_MaxSplits;
+
+        [[nodiscard]] inline const TChar* SeparatorData() const noexcept
+        {
+            return m_pSeparator ? m_pSeparator : m_EncodedSeparator;
+        }
+
+        //! \brief Find the first separator in the range of bytes, returns -1 if not found.
+        [[nodiscard]] inline SSize FindSeparator(const TChar* pBegin, const TChar* pEnd) const noexcept
+        {
+            if (m_SeparatorSize == 1)
+            {
+                return Internal::SimdFindFirstOf(pBegin, static_cast<USize>(pEnd - pBegin), SeparatorData()[0]);
+            }
+
+            if (m_SeparatorSize == 0)
+            {
+                return -1;
+            }
+
+            return Internal::FindSubstring(pBegin, static_cast<USize>(pEnd - pBegin), SeparatorData(), m_SeparatorSize);
+        }
+
+    public:
+        class Iterator
+        {
+            friend class StringSplitRange;
+
+            const StringSplitRange* m_pRange;
+            const TChar* m_pPart;
+            USize m_PartSize;
+            const TChar* m_pNext;
+            USize m_SplitsLeft;
+
+            //! \brief Find the next part starting from m_pNext, the iterator becomes the end iterator if there are none.
+            inline void FindNext() noexcept
+            {
+                const StringSplitRange& range = *m_pRange;
+                const TChar* pEnd             = range.m_String.Data() + range.m_String.Size();
+                const bool skipEmpty          = AnyFlagsActive(range.m_Options, SplitOptions::SkipEmpty);
+                const bool stripReturn        = AnyFlagsActive(range.m_Options, SplitOptions::StripCarriageReturn);
+                while (m_pNext != nullptr && m_pNext != pEnd)
+                {
+                    const TChar* pPartBegin = m_pNext;
+                    const TChar* pPartEnd   = pEnd;
+                    bool split              = false;
+                    if (m_SplitsLeft > 0)
+                    {
+                        const SSize index = range.FindSeparator(pPartBegin, pEnd);
+                        if (index >= 0)
+                        {
+                            pPartEnd = pPartBegin + index;
+                            split    = true;
+                        }
+                    }
+                    else if (skipEmpty && range.m_SeparatorSize > 0)
+                    {
+                        // The rest of the string shouldn't start with an empty part either.
+                        const TChar* pSeparator = range.SeparatorData();
+                        while (static_cast<USize>(pEnd - pPartBegin) >= range.m_SeparatorSize
+                               && memcmp(pPartBegin, pSeparator, range.m_SeparatorSize) == 0)
+                        {
+                            pPartBegin += range.m_SeparatorSize;
+                        }
+                    }
+
+                    m_pNext = split ? pPartEnd + range.m_SeparatorSize : pEnd;
+                    if (stripReturn)
+                    {
+                        while (pPartEnd != pPartBegin && pPartEnd[-1] == '\r')
+                        {
+                            --pPartEnd;
+                        }
+                    }
+
+                    if (skipEmpty && pPartEnd == pPartBegin)
+                    {
+                        continue;
+                    }
+
+                    if (split)
+                    {
+                        --m_SplitsLeft;
+                    }
+
+                    m_pPart    = pPartBegin;
+                    m_PartSize = static_cast<USize>(pPartEnd - pPartBegin);
+                    return;
+                }
+
+                m_pPart    = nullptr;
+                m_PartSize = 0;
+                m_pNext    = nullptr;
+            }
+
+            inline Iterator(const StringSplitRange* pRange, const TChar* pNext) noexcept
+                : m_pRange(pRange)
+                , m_pPart(nullptr)
+                , m_PartSize(0)
+                , m_pNext(pNext)
+                , m_SplitsLeft(pRange ? pRange->m_MaxSplits : 0)
+            {
+                if (m_pNext)
+                {
+                    FindNext();
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = StringSlice;
+            using pointer           = const StringSlice*;
+            using reference         = StringSlice;
+
+            inline StringSlice operator*() const noexcept
+            {
+                UN_Assert(m_pPart, "Can't dereference the end iterator");
+                return { m_pPart, m_PartSize };
+            }
+
+            inline Iterator& operator++() noexcept
+            {
+                FindNext();
+                return *this;
+            }
+
+            inline Iterator operator++(int) noexcept
+            {
+                Iterator t = *this;
+                FindNext();
+                return t;
+            }
+
+            inline friend bool operator==(const Iterator& a, const Iterator& b) noexcept
+            {
+                return a.m_pPart == b.m_pPart;
+            }
+
+            inline friend bool operator!=(const Iterator& a, const Iterator& b) noexcept
+            {
+                return a.m_pPart != b.m_pPart;
+            }
+        };
+
+        inline StringSplitRange(StringSlice str, TCodepoint separator, SplitOptions options, USize maxSplits) noexcept
+            : m_String(str)
+            , m_pSeparator(nullptr)
+            , m_SeparatorSize(UTF8::Encode(separator, m_EncodedSeparator))
+            , m_Options(options)
+            , m_MaxSplits(maxSplits)
+        {
+        }
+
+        inline StringSplitRange(StringSlice str, StringSlice separator, SplitOptions options, USize maxSplits) noexcept
+            : m_String(str)
+            , m_pSeparator(separator.Data())
+            , m_SeparatorSize(separator.Size())
+            , m_EncodedSeparator()
+            , m_Options(options)
+            , m_MaxSplits(maxSplits)
+        {
+            UN_Assert(separator.Size() > 0, "Separator can't be empty");
+        }
+
+        [[nodiscard]] inline Iterator begin() const noexcept
+        {
+            return Iterator(this, m_String.Data());
+        }
+
+        [[nodiscard]] inline Iterator end() const noexcept
+        {
+            return Iterator(nullptr, nullptr);
+        }
+    };
+
+    inline StringSplitRange StringSlice::SplitIter(TCodepoint separator, SplitOptions options, USize maxSplits) const noexcept
+    {
+        return StringSplitRange(*this, separator, options, maxSplits);
+    }
+
+    inline StringSplitRange StringSlice::SplitIter(StringSlice separator, SplitOptions options, USize maxSplits) const noexcept
+    {
+        return StringSplitRange(*this, separator, options, maxSplits);
+    }
+
+    inline StringSplitRange StringSlice::LinesIter(SplitOptions options) const noexcept
+    {
+        return StringSplitRange(*this, '\n', options | SplitOptions::StripCarriageReturn, std::numeric_limits<USize>::max());
+    }
+
     inline bool operator==(const StringSlice& lhs, const StringSlice& rhs) noexcept
     {
         return lhs.Size() == rhs.Size() && lhs.Compare(rhs) == 0;
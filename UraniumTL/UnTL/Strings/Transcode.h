@@ -0,0 +1,438 @@
+#pragma once
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Strings/Unicode.h>
+
+namespace UN::UTF8
+{
+    namespace Internal
+    {
+        inline constexpr UInt32 ReplacementCharacter = 0xfffd;
+
+        //! \brief Store 16 ASCII bytes as 16 UTF-16 or UTF-32 code units.
+        template<class TUnit>
+        UN_FINLINE void WidenAscii(__m128i bytes, TUnit* pDest) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i low  = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+            if constexpr (sizeof(TUnit) == 2)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest), low);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 8), high);
+            }
+            else
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest), _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 4), _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 8), _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + 12), _mm_unpackhi_epi16(high, zero));
+            }
+        }
+
+        //! \brief Load 8 UTF-16 or UTF-32 code units and narrow them to bytes if they are all ASCII.
+        //!
+        //! \return True if all the units were ASCII and were stored to pDest.
+        template<class TUnit>
+        UN_FINLINE bool TryNarrowAscii(const TUnit* pSource, UInt8* pDest) noexcept
+        {
+            __m128i units;
+            if constexpr (sizeof(TUnit) == 2)
+            {
+                units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x80)), _mm_setzero_si128())) != 0xffff)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource));
+                const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + 4));
+                const __m128i any  = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi32(-0x80));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, _mm_setzero_si128())) != 0xffff)
+                {
+                    return false;
+                }
+
+                units = _mm_packs_epi32(low, high);
+            }
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(pDest), _mm_packus_epi16(units, units));
+            return true;
+        }
+
+        //! \brief Convert UTF-8 to UTF-16 (if sizeof(TUnit) == 2) or UTF-32 (if sizeof(TUnit) == 4).
+        //!
+        //! Runs of ASCII are converted 16 bytes at a time, other codepoints are decoded inline. Invalid input
+        //! is decoded with the same rules as UTF8::Valid: each maximal subpart of an ill-formed sequence
+        //! is replaced with a single U+FFFD, and the byte that broke the sequence is decoded on its own.
+        //!
+        //! \return The number of units written, stops early if the destination is too small.
+        template<class TUnit>
+        inline USize Utf8ToUnits(const UInt8* pSource, USize sourceLength, TUnit* pDest, USize destLength) noexcept
+        {
+            static_assert(sizeof(TUnit) == 2 || sizeof(TUnit) == 4);
+
+            USize sourceIndex = 0;
+            USize destIndex   = 0;
+            while (sourceIndex < sourceLength)
+            {
+                const UInt8 lead = pSource[sourceIndex];
+                if (lead < 0x80)
+                {
+                    if (sourceIndex + 16 <= sourceLength && destIndex + 16 <= destLength)
+                    {
+                        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + sourceIndex));
+                        const UInt32 mask   = static_cast<UInt32>(_mm_movemask_epi8(bytes));
+                        if (mask == 0)
+                        {
+                            WidenAscii(bytes, pDest + destIndex);
+                            sourceIndex += 16;
+                            destIndex += 16;
+                            continue;
+                        }
+
+                        // Copy the ASCII bytes up to the first non-ASCII one, at least one.
+                        const UInt32 asciiCount = Bits::CountTrailingZeros(mask);
+                        for (UInt32 i = 0; i < asciiCount; ++i)
+                        {
+                            pDest[destIndex + i] = static_cast<TUnit>(pSource[sourceIndex + i]);
+                        }
+
+                        sourceIndex += asciiCount;
+                        destIndex += asciiCount;
+                        continue;
+                    }
+
+                    if (destIndex == destLength)
+                    {
+                        break;
+                    }
+
+                    pDest[destIndex++] = static_cast<TUnit>(lead);
+                    ++sourceIndex;
+                    continue;
+                }
+
+                // Take the lead byte and as many valid continuation bytes as there are. If the sequence
+                // is not complete, all of them form a maximal subpart that is replaced with U+FFFD.
+                const UInt8* pBytes  = pSource + sourceIndex;
+                const USize tailSize = sourceLength - sourceIndex - 1;
+
+                USize tailLength = 0;
+                UInt8 min, max;
+                USize length = 1;
+                if (GetSequenceRange(lead, tailLength, min, max) && tailSize > 0 && pBytes[1] >= min && pBytes[1] <= max)
+                {
+                    length = 2;
+                    while (length <= tailLength && length <= tailSize && !IsCodepointStart(pBytes[length]))
+                    {
+                        ++length;
+                    }
+                }
+
+                UInt32 codepoint = ReplacementCharacter;
+                if (length > 1 && length == tailLength + 1)
+                {
+                    switch (length)
+                    {
+                    case 2:
+                        codepoint = (lead & 0x1fu) << 6 | (pBytes[1] & 0x3fu);
+                        break;
+                    case 3:
+                        codepoint = (lead & 0x0fu) << 12 | (pBytes[1] & 0x3fu) << 6 | (pBytes[2] & 0x3fu);
+                        break;
+                    default:
+                        codepoint = (lead & 0x07u) << 18 | (pBytes[1] & 0x3fu) << 12 | (pBytes[2] & 0x3fu) << 6 | (pBytes[3] & 0x3fu);
+                        break;
+                    }
+                }
+
+                sourceIndex += length;
+
+                if constexpr (sizeof(TUnit) == 2)
+                {
+                    if (codepoint >= 0x10000)
+                    {
+                        if (destIndex + 2 > destLength)
+                        {
+                            break;
+                        }
+
+                        codepoint -= 0x10000;
+                        pDest[destIndex++] = static_cast<TUnit>(0xd800 + (codepoint >> 10));
+                        pDest[destIndex++] = static_cast<TUnit>(0xdc00 + (codepoint & 0x3ff));
+                        continue;
+                    }
+                }
+
+                if (destIndex == destLength)
+                {
+                    break;
+                }
+
+                pDest[destIndex++] = static_cast<TUnit>(codepoint);
+            }
+
+            return destIndex;
+        }
+
+        //! \brief Convert UTF-16 (if sizeof(TUnit) == 2) or UTF-32 (if sizeof(TUnit) == 4) to UTF-8.
+        //!
+        //! Runs of ASCII are converted 8 units at a time, other codepoints are encoded inline. Unpaired
+        //! surrogates and values above U+10FFFF are replaced with U+FFFD.
+        //!
+        //! \return The number of bytes written, stops early if the destination is too small.
+        template<class TUnit>
+        inline USize UnitsToUtf8(const TUnit* pSource, USize sourceLength, UInt8* pDest, USize destLength) noexcept
+        {
+            static_assert(sizeof(TUnit) == 2 || sizeof(TUnit) == 4);
+
+            USize sourceIndex = 0;
+            USize destIndex   = 0;
+            while (sourceIndex < sourceLength)
+            {
+                UInt32 codepoint = static_cast<UInt32>(pSource[sourceIndex]);
+                if (codepoint < 0x80)
+                {
+                    if (sourceIndex + 8 <= sourceLength && destIndex + 8 <= destLength
+                        && TryNarrowAscii(pSource + sourceIndex, pDest + destIndex))
+                    {
+                        sourceIndex += 8;
+                        destIndex += 8;
+                        continue;
+                    }
+
+                    if (destIndex == destLength)
+                    {
+                        break;
+                    }
+
+                    pDest[destIndex++] = static_cast<UInt8>(codepoint);
+                    ++sourceIndex;
+                    continue;
+                }
+
+                USize consumed = 1;
+                if ((codepoint & 0xfffff800) == 0xd800)
+                {
+                    codepoint = ReplacementCharacter;
+                    if constexpr (sizeof(TUnit) == 2)
+                    {
+                        const UInt32 high = static_cast<UInt32>(pSource[sourceIndex]);
+                        if (high < 0xdc00 && sourceIndex + 1 < sourceLength)
+                        {
+                            const UInt32 low = static_cast<UInt32>(pSource[sourceIndex + 1]);
+                            if ((low & 0xfffffc00) == 0xdc00)
+                            {
+                                codepoint = 0x10000 + ((high - 0xd800) << 10) + (low - 0xdc00);
+                                consumed  = 2;
+                            }
+                        }
+                    }
+                }
+                else if (codepoint > 0x10ffff)
+                {
+                    codepoint = ReplacementCharacter;
+                }
+
+                const USize length = codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+                if (destIndex + length > destLength)
+                {
+                    break;
+                }
+
+                UInt8* pBytes = pDest + destIndex;
+                switch (length)
+                {
+                case 2:
+                    pBytes[0] = static_cast<UInt8>(0xc0 | (codepoint >> 6));
+                    pBytes[1] = static_cast<UInt8>(0x80 | (codepoint & 0x3f));
+                    break;
+                case 3:
+                    pBytes[0] = static_cast<UInt8>(0xe0 | (codepoint >> 12));
+                    pBytes[1] = static_cast<UInt8>(0x80 | ((codepoint >> 6) & 0x3f));
+                    pBytes[2] = static_cast<UInt8>(0x80 | (codepoint & 0x3f));
+                    break;
+                default:
+                    pBytes[0] = static_cast<UInt8>(0xf0 | (codepoint >> 18));
+                    pBytes[1] = static_cast<UInt8>(0x80 | ((codepoint >> 12) & 0x3f));
+                    pBytes[2] = static_cast<UInt8>(0x80 | ((codepoint >> 6) & 0x3f));
+                    pBytes[3] = static_cast<UInt8>(0x80 | (codepoint & 0x3f));
+                    break;
+                }
+
+                sourceIndex += consumed;
+                destIndex += length;
+            }
+
+            return destIndex;
+        }
+
+        //! \brief Count the UTF-16 units needed for UTF-8: one per codepoint plus one per 4-byte sequence.
+        inline USize CountUtf16Units(const UInt8* pSource, USize length) noexcept
+        {
+            USize result = 0;
+            USize index  = 0;
+            for (; index + 16 <= length; index += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + index));
+
+                // Lead bytes of 4-byte sequences are 0xf0..0xff, that is -16..-1 as signed bytes.
+                const UInt32 nonAscii = static_cast<UInt32>(_mm_movemask_epi8(bytes));
+                const UInt32 fourByte = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-17))));
+                result += Bits::PopCount(Sse2Utf8Ops::StartMask(bytes)) + Bits::PopCount(nonAscii & fourByte);
+            }
+
+            for (; index < length; ++index)
+            {
+                result += IsCodepointStart(pSource[index]) + (pSource[index] >= 0xf0);
+            }
+
+            return result;
+        }
+
+        //! \brief Get the number of UTF-8 bytes needed to encode a codepoint.
+        UN_FINLINE USize GetEncodedLength(UInt32 codepoint) noexcept
+        {
+            return codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+        }
+
+        //! \brief Count the UTF-8 bytes needed for UTF-16 or UTF-32, 8 units at a time.
+        template<class TUnit>
+        inline USize CountUtf8Bytes(const TUnit* pSource, USize length) noexcept
+        {
+            USize result = 0;
+            USize index  = 0;
+            if constexpr (sizeof(TUnit) == 2)
+            {
+                // Every unit takes 3 bytes, minus one if it's below 0x80, minus one if it's below 0x800 and
+                // minus one if it's a surrogate: a surrogate pair takes 4 bytes.
+                const __m128i zero = _mm_setzero_si128();
+                for (; index + 8 <= length; index += 8)
+                {
+                    const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + index));
+                    const __m128i high5 = _mm_and_si128(units, _mm_set1_epi16(-0x800));
+
+                    const auto ascii     = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x80)), zero));
+                    const auto twoByte   = _mm_movemask_epi8(_mm_cmpeq_epi16(high5, zero));
+                    const auto surrogate = _mm_movemask_epi8(_mm_cmpeq_epi16(high5, _mm_set1_epi16(-0x2800)));
+                    const UInt32 smaller = Bits::PopCount(static_cast<UInt32>(ascii)) + Bits::PopCount(static_cast<UInt32>(twoByte))
+                        + Bits::PopCount(static_cast<UInt32>(surrogate));
+                    result += 3 * 8 - smaller / 2;
+                }
+
+                for (; index < length; ++index)
+                {
+                    const UInt32 unit = pSource[index];
+                    result += (unit & 0xf800) == 0xd800 ? 2 : GetEncodedLength(unit);
+                }
+
+                return result;
+            }
+            else
+            {
+                for (; index + 4 <= length; index += 4)
+                {
+                    const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + index));
+                    const auto above1 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(units, _mm_set1_epi32(0x7f))));
+                    const auto above2 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(units, _mm_set1_epi32(0x7ff))));
+                    const auto above3 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(units, _mm_set1_epi32(0xffff))));
+                    result += 4 + Bits::PopCount(static_cast<UInt32>(above1)) + Bits::PopCount(static_cast<UInt32>(above2))
+                        + Bits::PopCount(static_cast<UInt32>(above3));
+                }
+
+                for (; index < length; ++index)
+                {
+                    result += GetEncodedLength(static_cast<UInt32>(pSource[index]));
+                }
+
+                return result;
+            }
+        }
+    } // namespace Internal
+
+    //! \brief Get the number of UTF-16 code units needed to store a UTF-8 string.
+    //!
+    //! \param source - A valid UTF-8 string, see UTF8::Valid.
+    [[nodiscard]] inline USize GetUtf16Length(ArraySlice<const TChar> source) noexcept
+    {
+        return Internal::CountUtf16Units(reinterpret_cast<const UInt8*>(source.Data()), source.Length());
+    }
+
+    //! \brief Get the number of UTF-32 code units (codepoints) needed to store a UTF-8 string.
+    //!
+    //! \param source - A valid UTF-8 string, see UTF8::Valid.
+    [[nodiscard]] inline USize GetUtf32Length(ArraySlice<const TChar> source) noexcept
+    {
+        return Length(source.Data(), source.Length());
+    }
+
+    //! \brief Get the number of bytes needed to store a UTF-16 string as UTF-8.
+    //!
+    //! \param source - A UTF-16 string without unpaired surrogates.
+    [[nodiscard]] inline USize GetLengthFromUtf16(ArraySlice<const char16_t> source) noexcept
+    {
+        return Internal::CountUtf8Bytes(source.Data(), source.Length());
+    }
+
+    //! \brief Get the number of bytes needed to store a UTF-32 string as UTF-8.
+    //!
+    //! \param source - A UTF-32 string of Unicode scalar values (no surrogates, not above U+10FFFF).
+    [[nodiscard]] inline USize GetLengthFromUtf32(ArraySlice<const char32_t> source) noexcept
+    {
+        return Internal::CountUtf8Bytes(source.Data(), source.Length());
+    }
+
+    //! \brief Convert a UTF-8 string to UTF-16.
+    //!
+    //! The output is exact for valid input. Invalid input never causes reads or writes out of bounds,
+    //! but each maximal subpart of an ill-formed sequence is replaced with U+FFFD and the output length may
+    //! differ from GetUtf16Length().
+    //!
+    //! \param source      - A valid UTF-8 string, see UTF8::Valid.
+    //! \param destination - The buffer to write the result to, must have at least GetUtf16Length(source) units.
+    //!
+    //! \return The number of units written.
+    inline USize TranscodeToUtf16(ArraySlice<const TChar> source, ArraySlice<char16_t> destination) noexcept
+    {
+        return Internal::Utf8ToUnits(
+            reinterpret_cast<const UInt8*>(source.Data()), source.Length(), destination.Data(), destination.Length());
+    }
+
+    //! \brief Convert a UTF-8 string to UTF-32, see TranscodeToUtf16.
+    //!
+    //! \param source      - A valid UTF-8 string, see UTF8::Valid.
+    //! \param destination - The buffer to write the result to, must have at least GetUtf32Length(source) units.
+    //!
+    //! \return The number of units written.
+    inline USize TranscodeToUtf32(ArraySlice<const TChar> source, ArraySlice<char32_t> destination) noexcept
+    {
+        return Internal::Utf8ToUnits(
+            reinterpret_cast<const UInt8*>(source.Data()), source.Length(), destination.Data(), destination.Length());
+    }
+
+    //! \brief Convert a UTF-16 string to UTF-8, unpaired surrogates are replaced with U+FFFD.
+    //!
+    //! \param source      - A UTF-16 string.
+    //! \param destination - The buffer to write the result to, must have at least GetLengthFromUtf16(source) bytes.
+    //!
+    //! \return The number of bytes written.
+    inline USize TranscodeFromUtf16(ArraySlice<const char16_t> source, ArraySlice<TChar> destination) noexcept
+    {
+        return Internal::UnitsToUtf8(
+            source.Data(), source.Length(), reinterpret_cast<UInt8*>(destination.Data()), destination.Length());
+    }
+
+    //! \brief Convert a UTF-32 string to UTF-8, surrogates and values above U+10FFFF are replaced with U+FFFD.
+    //!
+    //! \param source      - A UTF-32 string.
+    //! \param destination - The buffer to write the result to, must have at least GetLengthFromUtf32(source) bytes.
+    //!
+    //! \return The number of bytes written.
+    inline USize TranscodeFromUtf32(ArraySlice<const char32_t> source, ArraySlice<TChar> destination) noexcept
+    {
+        return Internal::UnitsToUtf8(
+            source.Data(), source.Length(), reinterpret_cast<UInt8*>(destination.Data()), destination.Length());
+    }
+} // namespace UN::UTF8
@@ -1,6 +1,7 @@
 #pragma once
 #include <UnTL/Base/Base.h>
 #include <UnTL/RTTI/RTTI.h>
+#include <UnTL/Strings/Internal/SimdUtf8.h>
 #include <cassert>
 #include <cstdint>
 #include <string>
@@ -84,6 +85,48 @@ namespace UN::UTF8
         return c;
     }
 
+    //! \brief Encode a codepoint as UTF-8.
+    //!
+    //! \param codepoint - The codepoint to encode.
+    //! \param pBuffer   - The buffer to write to, must have space for 4 bytes.
+    //!
+    //! \return The number of bytes written, 0 if the codepoint is above U+10FFFF.
+    inline size_t Encode(TCodepoint codepoint, TChar* pBuffer) noexcept
+    {
+        auto* pBytes = reinterpret_cast<UInt8*>(pBuffer);
+        if (codepoint < 0x80)
+        {
+            pBytes[0] = static_cast<UInt8>(codepoint);
+            return 1;
+        }
+
+        if (codepoint < 0x800)
+        {
+            pBytes[0] = static_cast<UInt8>(0xc0 | (codepoint >> 6));
+            pBytes[1] = static_cast<UInt8>(0x80 | (codepoint & 0x3f));
+            return 2;
+        }
+
+        if (codepoint < 0x10000)
+        {
+            pBytes[0] = static_cast<UInt8>(0xe0 | (codepoint >> 12));
+            pBytes[1] = static_cast<UInt8>(0x80 | ((codepoint >> 6) & 0x3f));
+            pBytes[2] = static_cast<UInt8>(0x80 | (codepoint & 0x3f));
+            return 3;
+        }
+
+        if (codepoint < 0x110000)
+        {
+            pBytes[0] = static_cast<UInt8>(0xf0 | (codepoint >> 18));
+            pBytes[1] = static_cast<UInt8>(0x80 | ((codepoint >> 12) & 0x3f));
+            pBytes[2] = static_cast<UInt8>(0x80 | ((codepoint >> 6) & 0x3f));
+            pBytes[3] = static_cast<UInt8>(0x80 | (codepoint & 0x3f));
+            return 4;
+        }
+
+        return 0;
+    }
+
     inline TCodepoint DecodePrior(const TChar*& it) noexcept
     {
         UInt32 c          = 0;
@@ -106,15 +149,15 @@ namespace UN::UTF8
         return Decode(it);
     }
 
+    //! \brief Compare two UTF-8 strings by codepoints.
+    //!
+    //! Byte order of UTF-8 is the same as codepoint order, so the strings are compared with memcmp.
     inline int Compare(const TChar* lhs, const TChar* rhs, size_t length1, size_t length2) noexcept
     {
-        size_t length = std::min(length1, length2);
-        for (; 0 < length; --length, Decode(lhs), Decode(rhs))
+        const size_t length = std::min(length1, length2);
+        if (const int result = length == 0 ? 0 : memcmp(lhs, rhs, length); result != 0)
         {
-            if (*lhs != *rhs)
-            {
-                return PeekDecode(lhs) < PeekDecode(rhs) ? -1 : +1;
-            }
+            return result < 0 ? -1 : +1;
         }
 
         if (length1 == length2)
@@ -125,6 +168,7 @@ namespace UN::UTF8
         return length1 < length2 ? -1 : 1;
     }
 
+    //! \brief Check if two UTF-8 strings are equal, case-insensitive comparison only folds ASCII letters.
     inline bool AreEqual(const TChar* lhs, const TChar* rhs, size_t length1, size_t length2, bool caseSensitive = true) noexcept
     {
         if (length1 != length2)
@@ -132,18 +176,19 @@ namespace UN::UTF8
             return false;
         }
 
-        auto normalizeChar = [caseSensitive](TCodepoint cp) -> TCodepoint {
-            if (caseSensitive)
-            {
-                return cp;
-            }
+        if (caseSensitive)
+        {
+            return length1 == 0 || memcmp(lhs, rhs, length1) == 0;
+        }
 
-            return std::isalpha(static_cast<char>(cp)) ? std::tolower(static_cast<char>(cp)) : cp;
+        // Bytes of multibyte sequences are never ASCII letters, so the strings can be compared bytewise.
+        auto toLower = [](TChar c) {
+            return c >= 'A' && c <= 'Z' ? static_cast<TChar>(c - 'A' + 'a') : c;
         };
 
-        for (; 0 < length1; --length1, Decode(lhs), Decode(rhs))
+        for (size_t i = 0; i < length1; ++i)
         {
-            if (normalizeChar(*lhs) != normalizeChar(*rhs))
+            if (toLower(lhs[i]) != toLower(rhs[i]))
             {
                 return false;
             }
@@ -152,30 +197,33 @@ namespace UN::UTF8
         return true;
     }
 
+    //! \brief Count the codepoints in a UTF-8 string, the string must be valid.
+    //!
+    //! Counts the bytes that are not continuation bytes, 16 or 32 bytes at a time.
     inline size_t Length(const TChar* str, size_t byteLen) noexcept
     {
-        size_t result = 0;
-        while (byteLen-- && Decode(str))
-            ++result;
-        return result;
+        return Internal::SimdCountCodepoints(reinterpret_cast<const UInt8*>(str), byteLen);
     }
 
-    inline void Advance(const TChar*& str, size_t n) noexcept
+    //! \brief Advance a pointer by N codepoints, but not past the end.
+    //!
+    //! Skips 16 or 32 bytes at a time while they contain fewer than N codepoints.
+    inline void Advance(const TChar*& str, const TChar* end, size_t n) noexcept
     {
-        while (n-- && Decode(str))
-        {
-        }
+        str += Internal::SimdSkipCodepoints(reinterpret_cast<const UInt8*>(str), end - str, n);
+    }
+
+    //! \brief Check if a string is valid UTF-8.
+    //!
+    //! Rejects invalid bytes, overlong encodings, surrogates, codepoints above U+10FFFF and truncated sequences.
+    inline bool Valid(const TChar* str, size_t byteLen) noexcept
+    {
+        return Internal::SimdValidate(reinterpret_cast<const UInt8*>(str), byteLen);
     }
 
+    //! \brief Check if a null-terminated string is valid UTF-8.
     inline bool Valid(const TChar* str) noexcept
     {
-        UInt32 c;
-        int e = 0;
-        while (*str)
-        {
-            void* input = reinterpret_cast<void*>(const_cast<TChar*>(str));
-            str         = static_cast<const TChar*>(Internal::utf8_decode(input, &c, &e));
-        }
-        return e == 0;
+        return Valid(str, TCharTraits::length(str));
     }
 } // namespace UN::UTF8
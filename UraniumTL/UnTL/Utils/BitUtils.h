@@ -17,6 +17,44 @@ namespace UN::Bits
         return _BitScanReverse(&lz, value) ? 31 - lz : 32;
     }
 
+    UN_FINLINE UInt32 CountTrailingZeros(UInt64 value) noexcept
+    {
+        unsigned long tz = 0;
+        return _BitScanForward64(&tz, value) ? tz : 64;
+    }
+
+    UN_FINLINE UInt32 CountLeadingZeros(UInt64 value) noexcept
+    {
+        unsigned long lz = 0;
+        return _BitScanReverse64(&lz, value) ? 63 - lz : 64;
+    }
+
+#    if UN_AVX2_SUPPORTED
+    UN_FINLINE UInt32 PopCount(UInt32 value) noexcept
+    {
+        return __popcnt(value);
+    }
+
+    UN_FINLINE UInt32 PopCount(UInt64 value) noexcept
+    {
+        return static_cast<UInt32>(__popcnt64(value));
+    }
+#    else
+    // The POPCNT instruction is not guaranteed to be available without AVX2, use the SWAR algorithm.
+    UN_FINLINE UInt32 PopCount(UInt64 value) noexcept
+    {
+        value = value - ((value >> 1) & 0x5555555555555555ull);
+        value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+        value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<UInt32>((value * 0x0101010101010101ull) >> 56);
+    }
+
+    UN_FINLINE UInt32 PopCount(UInt32 value) noexcept
+    {
+        return PopCount(static_cast<UInt64>(value));
+    }
+#    endif
+
 #else
 
     UN_FINLINE UInt32 CountTrailingZeros(UInt32 value) noexcept
@@ -29,5 +67,49 @@ namespace UN::Bits
         return __builtin_clz(value);
     }
 
+    UN_FINLINE UInt32 CountTrailingZeros(UInt64 value) noexcept
+    {
+        return __builtin_ctzll(value);
+    }
+
+    UN_FINLINE UInt32 CountLeadingZeros(UInt64 value) noexcept
+    {
+        return __builtin_clzll(value);
+    }
+
+    UN_FINLINE UInt32 PopCount(UInt32 value) noexcept
+    {
+        return __builtin_popcount(value);
+    }
+
+    UN_FINLINE UInt32 PopCount(UInt64 value) noexcept
+    {
+        return __builtin_popcountll(value);
+    }
+
 #endif
-} // namespace UN
+
+    //! \brief Clear the lowest set bit of an unsigned integer, e.g. 0b10110 -> 0b10100.
+    template<class T>
+    UN_FINLINE constexpr T ResetLowestSetBit(T value) noexcept
+    {
+        static_assert(std::is_unsigned_v<T>);
+        return value & (value - 1);
+    }
+
+    //! \brief Call a function for the index of every set bit of an unsigned integer, from lowest to highest.
+    //!
+    //! Function signature:
+    //! \code{.cpp}
+    //!     void f(UInt32 bitIndex);
+    //! \endcode
+    template<class T, class TFunc>
+    UN_FINLINE void ForEachSetBit(T value, TFunc&& f)
+    {
+        static_assert(std::is_same_v<T, UInt32> || std::is_same_v<T, UInt64>);
+        for (; value != 0; value = ResetLowestSetBit(value))
+        {
+            f(CountTrailingZeros(value));
+        }
+    }
+} // namespace UN::Bits
@@ -0,0 +1,8 @@
+CPMAddPackage(
+    NAME benchmark
+    GITHUB_REPOSITORY google/benchmark
+    VERSION 1.7.1
+    OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_INSTALL OFF" "BENCHMARK_ENABLE_GTEST_TESTS OFF"
+)
+
+set_target_properties(benchmark PROPERTIES FOLDER "ThirdParty")